@@ -1418,6 +1418,8 @@ FHoudiniAssetComponentDetails::OnFetchAssetHelp( UHoudiniAssetComponent * Houdin
 {
     if ( HoudiniAssetComponent )
     {
+        FHoudiniEngineScopedSession ScopedSession( HoudiniAssetComponent->GetSessionIndex() );
+
         HAPI_AssetInfo AssetInfo;
         HAPI_NodeId AssetId = HoudiniAssetComponent->GetAssetId();
 
@@ -479,15 +479,13 @@ FHoudiniEngineEditor::SaveHIPFile()
             FString Notification = TEXT("Saving internal Houdini scene...");
             FHoudiniEngineUtils::CreateSlateNotification(Notification);
 
-            // ... and a log message
-            HOUDINI_LOG_MESSAGE(TEXT("Saved Houdini scene to %s"), *SaveFilenames[ 0 ] );
-
-            // Get first path.
-            std::wstring HIPPath( *SaveFilenames[ 0 ] );
-            std::string HIPPathConverted( HIPPath.begin(), HIPPath.end() );
+            // Save HIP file of every session through Engine.
+            TArray< FString > SavedHIPPaths;
+            FHoudiniEngine::Get().SaveHIPFiles( SaveFilenames[ 0 ], SavedHIPPaths );
 
-            // Save HIP file through Engine.
-            FHoudiniApi::SaveHIPFile( FHoudiniEngine::Get().GetSession(), HIPPathConverted.c_str(), false );
+            // ... and a log message
+            for ( const FString & SavedHIPPath : SavedHIPPaths )
+                HOUDINI_LOG_MESSAGE( TEXT( "Saved Houdini scene to %s" ), *SavedHIPPath );
         }
     }
 }
@@ -510,34 +508,36 @@ FHoudiniEngineEditor::OpenInHoudini()
         FPlatformProcess::UserTempDir(), 
         TEXT( "HoudiniEngine" ), TEXT( ".hip" ) );
 
-    // Save HIP file through Engine.
-    std::string TempPathConverted( TCHAR_TO_UTF8( *UserTempPath ) );
-    FHoudiniApi::SaveHIPFile(
-        FHoudiniEngine::Get().GetSession(), 
-        TempPathConverted.c_str(), false);
-
-    if ( !FPaths::FileExists( UserTempPath ) )
-        return;
+    // Save HIP file of every session through Engine.
+    TArray< FString > SavedHIPPaths;
+    FHoudiniEngine::Get().SaveHIPFiles( UserTempPath, SavedHIPPaths );
 
     // Add a slate notification
     FString Notification = TEXT( "Opening scene in Houdini..." );
     FHoudiniEngineUtils::CreateSlateNotification( Notification );
 
-    // ... and a log message
-    HOUDINI_LOG_MESSAGE( TEXT("Opened scene in Houdini.") );
-
-    // Add quotes to the path to avoid issues with spaces
-    UserTempPath = TEXT("\"") + UserTempPath + TEXT("\"");
-    // Then open the hip file in Houdini
     FString LibHAPILocation = FHoudiniEngine::Get().GetLibHAPILocation();
     FString HoudiniLocation = LibHAPILocation + TEXT("//houdini");
-    FPlatformProcess::CreateProc( 
-        *HoudiniLocation, 
-        *UserTempPath, 
-        true, false, false, 
-        nullptr, 0,
-        FPlatformProcess::UserTempDir(),
-        nullptr, nullptr );
+    for ( const FString & SavedHIPPath : SavedHIPPaths )
+    {
+        if ( !FPaths::FileExists( SavedHIPPath ) )
+            continue;
+
+        // ... and a log message
+        HOUDINI_LOG_MESSAGE( TEXT( "Opened scene %s in Houdini." ), *SavedHIPPath );
+
+        // Add quotes to the path to avoid issues with spaces
+        FString QuotedHIPPath = TEXT("\"") + SavedHIPPath + TEXT("\"");
+
+        // Then open the hip file in Houdini, one instance per session.
+        FPlatformProcess::CreateProc(
+            *HoudiniLocation,
+            *QuotedHIPPath,
+            true, false, false,
+            nullptr, 0,
+            FPlatformProcess::UserTempDir(),
+            nullptr, nullptr );
+    }
 
     // Unfortunately, LaunchFileInDefaultExternalApplication doesn't seem to be working properly
     //FPlatformProcess::LaunchFileInDefaultExternalApplication( UserTempPath.GetCharArray().GetData(), nullptr, ELaunchVerb::Open );
@@ -1360,7 +1360,7 @@ FHoudiniEngineEditor::RestartSession()
     FString Notification = TEXT("Restarting Current Houdini Session");
     FHoudiniEngineUtils::CreateSlateNotification( Notification );
 
-    // Restart the current Houdini Engine Session
+    // Restart every Houdini Engine Session of the pool
     bool bSuccess = FHoudiniEngine::Get().RestartSession();
 
     // Notify all the HoudiniAssetComponent that they need to reinstantiate themselves in the new session.
@@ -2178,6 +2178,27 @@ FHoudiniParameterDetails::CreateWidgetInput( IDetailCategoryBuilder & LocalDetai
         ];
     }
 
+    // Checkbox Export as instances
+    if ( InParam.ChoiceIndex == EHoudiniAssetInputType::WorldInput )
+    {
+        VerticalBox->AddSlot().Padding( 2, 2, 5, 2 ).AutoHeight()
+        [
+            SNew( SCheckBox )
+            .Content()
+            [
+                SNew( STextBlock )
+                .Text( LOCTEXT( "ExportAsInstancesCheckbox", "Export meshes as instances" ) )
+                .ToolTipText( LOCTEXT( "ExportAsInstancesCheckboxTip", "Send each unique mesh once, and a point cloud with the transform and mesh of every selected actor." ) )
+                .Font( FEditorStyle::GetFontStyle( TEXT( "PropertyWindow.NormalFont" ) ) )
+            ]
+            .IsChecked( TAttribute< ECheckBoxState >::Create(
+                TAttribute< ECheckBoxState >::FGetter::CreateUObject(
+                &InParam, &UHoudiniAssetInput::IsCheckedExportOutlinerAsInstances ) ) )
+            .OnCheckStateChanged( FOnCheckStateChanged::CreateUObject(
+                &InParam, &UHoudiniAssetInput::CheckStateChangedExportOutlinerAsInstances ) )
+        ];
+    }
+
     if ( InParam.ChoiceIndex == EHoudiniAssetInputType::GeometryInput )
     {
         const int32 NumInputs = InParam.InputObjects.Num();
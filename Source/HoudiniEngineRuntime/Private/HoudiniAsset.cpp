@@ -34,6 +34,8 @@
 #include "HoudiniEngineRuntimePrivatePCH.h"
 #include "Paths.h"
 #include "HoudiniEngineUtils.h"
+#include "HoudiniEngine.h"
+#include "HoudiniRuntimeSettings.h"
 
 const uint32
 UHoudiniAsset::PersistenceFormatVersion = 2u;
@@ -43,6 +45,7 @@ UHoudiniAsset::UHoudiniAsset( const FObjectInitializer & ObjectInitializer )
     , AssetFileName( TEXT( "" ) )
     , AssetBytes( nullptr )
     , AssetBytesCount( 0 )
+    , AssetBytesHash( 0 )
     , FileFormatVersion( UHoudiniAsset::PersistenceFormatVersion )
     , HoudiniAssetFlagsPacked ( 0u )
 {}
@@ -67,6 +70,12 @@ UHoudiniAsset::CreateAsset( const uint8 * BufferStart, const uint8 * BufferEnd,
         }
     }
 
+    AssetBytesHash = AssetBytes ? FCrc::MemCrc32( AssetBytes, AssetBytesCount ) : 0;
+
+    // Libraries loaded from the previous data are stale now.
+    if ( FHoudiniEngine::IsLoaded() )
+        FHoudiniEngine::Get().InvalidateAssetLibraryCache( this );
+
     FString FileExtension = FPaths::GetExtension( InFileName );
 
     if ( FileExtension.Equals( TEXT( "hdalc" ), ESearchCase::IgnoreCase ) ||
@@ -87,6 +96,12 @@ UHoudiniAsset::GetAssetBytes() const
     return AssetBytes;
 }
 
+uint32
+UHoudiniAsset::GetAssetBytesHash() const
+{
+    return AssetBytesHash;
+}
+
 const FString &
 UHoudiniAsset::GetAssetFileName() const
 {
@@ -105,6 +120,24 @@ UHoudiniAsset::IsPreviewHoudiniLogo() const
     return bPreviewHoudiniLogo;
 }
 
+void
+UHoudiniAsset::PostLoad()
+{
+    Super::PostLoad();
+
+#if WITH_EDITOR
+
+    // Start loading our library in the background, sessions may still be warming up.
+    if ( !HasAnyFlags( RF_ClassDefaultObject | RF_ArchetypeObject ) && FHoudiniEngine::IsLoaded() )
+    {
+        const UHoudiniRuntimeSettings * HoudiniRuntimeSettings = GetDefault< UHoudiniRuntimeSettings >();
+        if ( HoudiniRuntimeSettings && HoudiniRuntimeSettings->bPreloadAssetLibraries )
+            FHoudiniEngine::Get().PreloadAssetLibrary( this );
+    }
+
+#endif
+}
+
 void
 UHoudiniAsset::FinishDestroy()
 {
@@ -150,6 +183,9 @@ UHoudiniAsset::Serialize( FArchive & Ar )
     if ( AssetBytes && AssetBytesCount )
         Ar.Serialize( AssetBytes, AssetBytesCount );
 
+    if ( Ar.IsLoading() )
+        AssetBytesHash = AssetBytes ? FCrc::MemCrc32( AssetBytes, AssetBytesCount ) : 0;
+
     // Serialize flags.
     Ar << HoudiniAssetFlagsPacked;
 
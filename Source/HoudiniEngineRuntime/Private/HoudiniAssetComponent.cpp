@@ -311,6 +311,7 @@ UHoudiniAssetComponent::UHoudiniAssetComponent( const FObjectInitializer & Objec
     CopiedHoudiniComponent = nullptr;
 #endif
     AssetId = -1;
+    SessionIndex = INDEX_NONE;
     GeneratedGeometryScaleFactor = HAPI_UNREAL_SCALE_FACTOR_POSITION;
     TransformScaleFactor = HAPI_UNREAL_SCALE_FACTOR_TRANSLATION;
     ImportAxis = HRSAI_Unreal;
@@ -495,6 +496,53 @@ UHoudiniAssetComponent::GetAssetId() const
     return AssetId;
 }
 
+int32
+UHoudiniAssetComponent::GetSessionIndex() const
+{
+    // Nodes of an instantiated asset only exist in the session it has been instantiated in.
+    if ( SessionIndex != INDEX_NONE )
+        return SessionIndex;
+
+    return ComputeSessionIndex();
+}
+
+int32
+UHoudiniAssetComponent::ComputeSessionIndex() const
+{
+    // Nodes can only be connected within a session, so walk up to the root of the asset input chain.
+    const UHoudiniAssetComponent * RootComponent = this;
+    bool bFoundRootComponent = false;
+    for ( int32 Depth = 0; Depth < HAPI_UNREAL_SESSION_POOL_SIZE_MAX * 4; ++Depth )
+    {
+        const UHoudiniAssetComponent * UpstreamComponent = nullptr;
+        for ( const UHoudiniAssetInput * HoudiniAssetInput : RootComponent->Inputs )
+        {
+            if ( HoudiniAssetInput && HoudiniAssetInput->GetChoiceIndex() == EHoudiniAssetInputType::AssetInput )
+            {
+                UpstreamComponent = HoudiniAssetInput->GetConnectedInputAssetComponent();
+                if ( UpstreamComponent && UpstreamComponent != RootComponent )
+                    break;
+
+                UpstreamComponent = nullptr;
+            }
+        }
+
+        if ( !UpstreamComponent )
+        {
+            bFoundRootComponent = true;
+            break;
+        }
+
+        RootComponent = UpstreamComponent;
+    }
+
+    // Upstream asset may already live in a session, which is not necessarily the one its GUID maps to.
+    if ( bFoundRootComponent && RootComponent != this )
+        return RootComponent->GetSessionIndex();
+
+    return FHoudiniEngine::Get().GetSessionIndexForGuid( RootComponent->ComponentGUID );
+}
+
 void
 UHoudiniAssetComponent::SetAssetId( HAPI_NodeId InAssetId )
 {
@@ -804,8 +852,12 @@ UHoudiniAssetComponent::CreateObjectGeoPartResources(
                 if (HoudiniGeoPartObject.IsCollidable())
                 {
                     StaticMeshComponent->SetVisibility( false );
-                    StaticMeshComponent->SetHiddenInGame( true );                                                                     
-                    StaticMeshComponent->SetCollisionProfileName( FName( TEXT( "InvisibleWall" ) ) );
+                    StaticMeshComponent->SetHiddenInGame( true );
+
+                    // Changing the profile recreates the physics state, only do it when needed.
+                    static const FName InvisibleWallProfileName( TEXT( "InvisibleWall" ) );
+                    if ( StaticMeshComponent->GetCollisionProfileName() != InvisibleWallProfileName )
+                        StaticMeshComponent->SetCollisionProfileName( InvisibleWallProfileName );
                 }
                 else
                 {
@@ -883,6 +935,36 @@ UHoudiniAssetComponent::CreateObjectGeoPartResources(
 }
 
 
+void
+UHoudiniAssetComponent::ReuseStaticMeshComponents(
+    const TMap< FHoudiniGeoPartObject, UStaticMesh * > & StaleStaticMeshMap,
+    const TMap< FHoudiniGeoPartObject, UStaticMesh * > & NewStaticMeshMap )
+{
+    for ( TMap< FHoudiniGeoPartObject, UStaticMesh * >::TConstIterator Iter( NewStaticMeshMap ); Iter; ++Iter )
+    {
+        const FHoudiniGeoPartObject & HoudiniGeoPartObject = Iter.Key();
+        UStaticMesh * NewStaticMesh = Iter.Value();
+        if ( !NewStaticMesh || !HoudiniGeoPartObject.IsVisible() )
+            continue;
+
+        UStaticMesh * const * FoundOldStaticMesh = StaleStaticMeshMap.Find( HoudiniGeoPartObject );
+        if ( !FoundOldStaticMesh || !*FoundOldStaticMesh || *FoundOldStaticMesh == NewStaticMesh )
+            continue;
+
+        // The old mesh must have a component, and the new one must not have one yet.
+        UStaticMesh * OldStaticMesh = *FoundOldStaticMesh;
+        UStaticMeshComponent * StaticMeshComponent = LocateStaticMeshComponent( OldStaticMesh );
+        if ( !StaticMeshComponent || LocateStaticMeshComponent( NewStaticMesh ) )
+            continue;
+
+        // Swap the mesh on the existing component, its render and physics state are updated in place.
+        StaticMeshComponents.Remove( OldStaticMesh );
+        StaticMeshComponent->SetStaticMesh( NewStaticMesh );
+        StaticMeshComponents.Add( NewStaticMesh, StaticMeshComponent );
+    }
+}
+
+
 void
 UHoudiniAssetComponent::ReleaseObjectGeoPartResources( bool bDeletePackages )
 {
@@ -1280,10 +1362,14 @@ UHoudiniAssetComponent::StartHoudiniTicking()
     {
         TimerDelegateCooking = FTimerDelegate::CreateUObject( this, &UHoudiniAssetComponent::TickHoudiniComponent );
 
-        // We need to register delegate with the timer system.
-        static const float TickTimerDelay = 0.25f;
+        // We need to register delegate with the timer system. Finished tasks notify us through their
+        // completion delegate, so this timer is only a fallback used for progress notifications.
+        static const float TickTimerDelay = 0.5f;
         GEditor->GetTimerManager()->SetTimer( TimerHandleCooking, TimerDelegateCooking, TickTimerDelay, true );
 
+        // Process pending changes on the next frame instead of waiting for the timer.
+        GEditor->GetTimerManager()->SetTimerForNextTick( TimerDelegateCooking );
+
         // Grab current time for delayed notification.
         HapiNotificationStarted = FPlatformTime::Seconds();
     }
@@ -1302,6 +1388,45 @@ UHoudiniAssetComponent::StopHoudiniTicking()
     }
 }
 
+EHoudiniEngineTaskPriority::Type
+UHoudiniAssetComponent::GetCookPriority() const
+{
+#if WITH_EDITOR
+    const AActor * Owner = GetOwner();
+    if ( Owner && ( Owner->IsSelected() || Owner->WasRecentlyRendered() ) )
+        return EHoudiniEngineTaskPriority::High;
+#endif
+
+    return EHoudiniEngineTaskPriority::Low;
+}
+
+void
+UHoudiniAssetComponent::InterruptStaleCook()
+{
+    // Asset id is only assigned once instantiated, so a task in flight with a valid asset id is a cook.
+    // Once interrupted, we will be notified and will submit a new cook with the changed parameters.
+    if ( IsInstantiatingOrCooking() && FHoudiniEngineUtils::IsValidAssetId( AssetId ) )
+        FHoudiniEngine::Get().InterruptTask( HapiGUID );
+}
+
+void
+UHoudiniAssetComponent::CancelCook()
+{
+    if ( IsInstantiatingOrCooking() && FHoudiniEngineUtils::IsValidAssetId( AssetId ) )
+        FHoudiniEngine::Get().CancelTask( HapiGUID );
+}
+
+float
+UHoudiniAssetComponent::GetCookProgress() const
+{
+    FHoudiniEngineTaskInfo TaskInfo;
+    if ( HapiGUID.IsValid() && FHoudiniEngine::Get().RetrieveTaskInfo( HapiGUID, TaskInfo )
+        && TaskInfo.TaskType == EHoudiniEngineTaskType::AssetCooking )
+        return TaskInfo.Progress;
+
+    return 0.0f;
+}
+
 void
 UHoudiniAssetComponent::PostCook( bool bCookError )
 {
@@ -1355,11 +1480,17 @@ UHoudiniAssetComponent::PostCook( bool bCookError )
             FHoudiniEngineUtils::UpdateUPropertyAttributesOnObject( this, HoudiniGeoPartObject );
         }
 
-        // Make sure rendering is done
-        FlushRenderingCommands();
-        
-        // Free meshes and components that are no longer used.
-        ReleaseObjectGeoPartResources( StaticMeshes, true );
+        // Parts whose mesh has been replaced keep their component, only the mesh is swapped.
+        ReuseStaticMeshComponents( StaticMeshes, NewStaticMeshes );
+
+        if ( StaticMeshes.Num() > 0 )
+        {
+            // Make sure rendering is done
+            FlushRenderingCommands();
+
+            // Free meshes and components that are no longer used.
+            ReleaseObjectGeoPartResources( StaticMeshes, true );
+        }
 
         // Update the bake folder as it might have been updated by an override
         BakeFolder = HoudiniCookParams.BakeFolder;
@@ -1394,6 +1525,20 @@ UHoudiniAssetComponent::PostCook( bool bCookError )
 void
 UHoudiniAssetComponent::TickHoudiniComponent()
 {
+    // Nothing can be processed until sessions are ready.
+    if ( FHoudiniEngine::Get().IsWarmingUpSessions() )
+        return;
+
+    // Asset input connections may have moved this asset to another session.
+    if ( SessionIndex != INDEX_NONE && !IsInstantiatingOrCooking() )
+    {
+        const int32 NewSessionIndex = ComputeSessionIndex();
+        if ( NewSessionIndex != SessionIndex )
+            MigrateToSession( NewSessionIndex );
+    }
+
+    FHoudiniEngineScopedSession ScopedSession( GetSessionIndex() );
+
     // Get settings.
     const UHoudiniRuntimeSettings * HoudiniRuntimeSettings = GetDefault< UHoudiniRuntimeSettings >();
 
@@ -1601,6 +1746,41 @@ UHoudiniAssetComponent::TickHoudiniComponent()
                 }
 
                 case EHoudiniEngineTaskState::Aborted:
+                {
+                    if ( TaskInfo.TaskType == EHoudiniEngineTaskType::AssetCooking )
+                    {
+                        HOUDINI_LOG_MESSAGE( TEXT( "    %s CookingCancelled." ), *GetOwner()->GetName() );
+
+                        // If this was the first cook, we still need parameters, inputs and handles.
+                        if ( AssetCookCount == 0 )
+                            PostCook( true );
+
+                        if ( NotificationPtr.IsValid() && bDisplaySlateCookingNotifications )
+                        {
+                            TSharedPtr< SNotificationItem > NotificationItem = NotificationPtr.Pin();
+                            if ( NotificationItem.IsValid() )
+                            {
+                                NotificationItem->SetText( TaskInfo.StatusText );
+                                NotificationItem->ExpireAndFadeout();
+
+                                NotificationPtr.Reset();
+                            }
+                        }
+
+                        FHoudiniEngine::Get().RemoveTaskInfo( HapiGUID );
+                        HapiGUID.Invalidate();
+
+                        // Outputs of the previous cook are kept, do not recook until requested.
+                        bManualRecookRequested = false;
+                        bStopTicking = true;
+                        AssetCookCount++;
+
+                        break;
+                    }
+
+                    // Aborted instantiation is handled as a failed instantiation.
+                }
+
                 case EHoudiniEngineTaskState::FinishedInstantiationWithErrors:
                 {
                     HOUDINI_LOG_ERROR( TEXT( "    %s FinishedInstantiationWithErrors." ), *GetOwner()->GetName() );
@@ -1895,6 +2075,17 @@ UHoudiniAssetComponent::UpdateEditorProperties( bool bConditionalUpdate )
 void
 UHoudiniAssetComponent::StartTaskAssetInstantiation( bool bLocalLoadedComponent, bool bStartTicking )
 {
+    // Sessions are still warming up, instantiate once they are ready.
+    if ( FHoudiniEngine::Get().IsWarmingUpSessions() )
+    {
+        bAssetIsBeingInstantiated = true;
+        FHoudiniEngine::Get().AddSessionsReadyDelegate( FSimpleDelegate::CreateUObject(
+            this, &UHoudiniAssetComponent::StartTaskAssetInstantiation, bLocalLoadedComponent, bStartTicking ) );
+        return;
+    }
+
+    FHoudiniEngineScopedSession ScopedSession( ComputeSessionIndex() );
+
     // We do not want to be instantiated twice
     bAssetIsBeingInstantiated = true;
 
@@ -1964,7 +2155,15 @@ UHoudiniAssetComponent::StartTaskAssetInstantiation( bool bLocalLoadedComponent,
             Task.bLoadedComponent = bLocalLoadedComponent;
             Task.AssetLibraryId = AssetLibraryId;
             Task.AssetHapiName = PickedAssetName;
+
+            // The asset lives in this session until it is deleted or migrated.
+            SessionIndex = FHoudiniEngine::GetBoundSessionIndex();
+            Task.SessionIndex = SessionIndex;
             FHoudiniEngine::Get().AddTask( Task );
+
+            // Get notified as soon as the instantiation finishes.
+            FHoudiniEngine::Get().SetTaskCompletionDelegate(
+                HapiGUID, FSimpleDelegate::CreateUObject( this, &UHoudiniAssetComponent::TickHoudiniComponent ) );
         }
         else
         {
@@ -2003,6 +2202,8 @@ UHoudiniAssetComponent::StartTaskAssetCookingManual()
 void
 UHoudiniAssetComponent::StartTaskAssetResetManual()
 {
+    FHoudiniEngineScopedSession ScopedSession( GetSessionIndex() );
+
     if ( !IsInstantiatingOrCooking() )
     {
         if ( FHoudiniEngineUtils::IsValidAssetId( GetAssetId() ) )
@@ -2032,6 +2233,8 @@ UHoudiniAssetComponent::StartTaskAssetResetManual()
 void
 UHoudiniAssetComponent::StartTaskAssetRebuildManual()
 {
+    FHoudiniEngineScopedSession ScopedSession( GetSessionIndex() );
+
     if ( !IsInstantiatingOrCooking() )
     {
         bool bInstantiate = false;
@@ -2075,6 +2278,8 @@ UHoudiniAssetComponent::StartTaskAssetDeletion()
 {
     if ( FHoudiniEngineUtils::IsValidAssetId( AssetId ) && bIsNativeComponent )
     {
+        FHoudiniEngineScopedSession ScopedSession( GetSessionIndex() );
+
         // Get the Asset's NodeInfo
         HAPI_NodeInfo AssetNodeInfo;
         FMemory::Memset< HAPI_NodeInfo >(AssetNodeInfo, 0);
@@ -2096,10 +2301,12 @@ UHoudiniAssetComponent::StartTaskAssetDeletion()
         // Create asset deletion task object and submit it for processing.
         FHoudiniEngineTask Task( EHoudiniEngineTaskType::AssetDeletion, HapiDeletionGUID );
         Task.AssetId = OBJNodeToDelete;
+        Task.SessionIndex = GetSessionIndex();
         FHoudiniEngine::Get().AddTask( Task );
 
         // Reset asset id
         AssetId = -1;
+        SessionIndex = INDEX_NONE;
 
         // We do not need to tick as we are not interested in result.
     }
@@ -2116,8 +2323,14 @@ UHoudiniAssetComponent::StartTaskAssetCooking( bool bStartTicking )
         FHoudiniEngineTask Task( EHoudiniEngineTaskType::AssetCooking, HapiGUID );
         Task.ActorName = GetOuter()->GetName();
         Task.AssetId = GetAssetId();
+        Task.SessionIndex = GetSessionIndex();
+        Task.Priority = GetCookPriority();
         FHoudiniEngine::Get().AddTask( Task );
 
+        // Get notified as soon as the cook finishes.
+        FHoudiniEngine::Get().SetTaskCompletionDelegate(
+            HapiGUID, FSimpleDelegate::CreateUObject( this, &UHoudiniAssetComponent::TickHoudiniComponent ) );
+
         if ( bStartTicking )
             StartHoudiniTicking();
     }
@@ -2201,6 +2414,8 @@ UHoudiniAssetComponent::PostEditChangeProperty( FPropertyChangedEvent & Property
     if ( !bIsNativeComponent )
         return;
 
+    FHoudiniEngineScopedSession ScopedSession( GetSessionIndex() );
+
     UProperty * Property = PropertyChangedEvent.MemberProperty;
 
     if ( !Property )
@@ -2763,6 +2978,8 @@ UHoudiniAssetComponent::CheckedUploadTransform()
     if ( !bFullyLoaded )
         return;
 
+    FHoudiniEngineScopedSession ScopedSession( GetSessionIndex() );
+
     // If we have to upload transforms.
     if ( bUploadTransformsToHoudiniEngine && AssetCookCount > 0 )
     {
@@ -4050,6 +4267,7 @@ UHoudiniAssetComponent::NotifyParameterChanged( UHoudiniAssetParameter * Houdini
     }
 
     bParametersChanged = true;
+    InterruptStaleCook();
     StartHoudiniTicking();
 }
 
@@ -4060,6 +4278,7 @@ UHoudiniAssetComponent::NotifyHoudiniSplineChanged( UHoudiniSplineComponent * Ho
         bLoadedComponentRequiresInstantiation = true;
 
     bParametersChanged = true;
+    InterruptStaleCook();
     StartHoudiniTicking();
 }
 
@@ -5917,6 +6136,7 @@ UHoudiniAssetComponent::NotifyAssetNeedsToBeReinstantiated()
     bFullyLoaded = false;
     AssetCookCount = 0;
     AssetId = -1;
+    SessionIndex = INDEX_NONE;
 
     // Mark all input as changed
     for ( TArray< UHoudiniAssetInput * >::TIterator IterInputs( Inputs ); IterInputs; ++IterInputs )
@@ -5935,4 +6155,78 @@ UHoudiniAssetComponent::NotifyAssetNeedsToBeReinstantiated()
     }
 }
 
+void
+UHoudiniAssetComponent::MigrateToSession( int32 NewSessionIndex )
+{
+    HOUDINI_LOG_MESSAGE(
+        TEXT( "%s moves from Houdini Engine session %d to session %d, reinstantiating it." ),
+        GetOwner() ? *GetOwner()->GetName() : *GetName(), SessionIndex, NewSessionIndex );
+
+    {
+        // Nodes are destroyed in the session they have been created in.
+        FHoudiniEngineScopedSession ScopedSession( SessionIndex );
+
+        TArray< UHoudiniAssetInput * > AllInputs = Inputs;
+        for ( TMap< HAPI_ParmId, UHoudiniAssetParameter * >::TIterator IterParams( Parameters ); IterParams; ++IterParams )
+        {
+            UHoudiniAssetInput * HoudiniAssetInput = Cast< UHoudiniAssetInput >( IterParams.Value() );
+            if ( HoudiniAssetInput )
+                AllInputs.AddUnique( HoudiniAssetInput );
+        }
+
+        for ( UHoudiniAssetInput * HoudiniAssetInput : AllInputs )
+        {
+            if ( !HoudiniAssetInput )
+                continue;
+
+            // Asset inputs only reference their upstream asset, which is migrated on its own.
+            if ( HoudiniAssetInput->GetChoiceIndex() != EHoudiniAssetInputType::AssetInput )
+                HoudiniAssetInput->DisconnectAndDestroyInputAsset();
+
+            HoudiniAssetInput->InvalidateNodeIds();
+        }
+
+        StartTaskAssetDeletion();
+    }
+
+    NotifyAssetNeedsToBeReinstantiated();
+
+    // Reinstantiate right away rather than on next recook.
+    bParametersChanged = true;
+    StartHoudiniTicking();
+}
+
+void
+UHoudiniAssetComponent::NotifySessionRestarted()
+{
+    // Results of a task running in the lost session are meaningless.
+    if ( HapiGUID.IsValid() )
+    {
+        FHoudiniEngine::Get().InterruptTask( HapiGUID );
+        HapiGUID.Invalidate();
+    }
+
+    bAssetIsBeingInstantiated = false;
+
+    // Input nodes were lost with the session as well.
+    for ( UHoudiniAssetInput * HoudiniAssetInput : Inputs )
+    {
+        if ( HoudiniAssetInput )
+            HoudiniAssetInput->InvalidateNodeIds();
+    }
+
+    for ( TMap< HAPI_ParmId, UHoudiniAssetParameter * >::TIterator IterParams( Parameters ); IterParams; ++IterParams )
+    {
+        UHoudiniAssetInput * HoudiniAssetInput = Cast< UHoudiniAssetInput >( IterParams.Value() );
+        if ( HoudiniAssetInput )
+            HoudiniAssetInput->InvalidateNodeIds();
+    }
+
+    NotifyAssetNeedsToBeReinstantiated();
+
+    // Reinstantiate right away rather than on next recook.
+    bParametersChanged = true;
+    StartHoudiniTicking();
+}
+
 #undef LOCTEXT_NAMESPACE
\ No newline at end of file
@@ -27,6 +27,7 @@
 #include "HoudiniGeoPartObject.h"
 #include "HoudiniRuntimeSettings.h"
 #include "HoudiniCookHandler.h"
+#include "HoudiniEngineTask.h"
 
 #include "CoreMinimal.h"
 #include "Landscape.h"
@@ -260,15 +261,31 @@ public:
         /** Set id of a Houdini asset. **/
         void SetAssetId( HAPI_NodeId InAssetId );
 
+        /** Cancel the cook in progress, outputs of the previous cook are kept. **/
+        UFUNCTION( BlueprintCallable, Category = HoudiniAsset )
+        void CancelCook();
+
+        /** Return progress of the cook in progress between 0 and 1. **/
+        UFUNCTION( BlueprintCallable, Category = HoudiniAsset )
+        float GetCookProgress() const;
+
         /** Return true if asset id is valid. **/
         bool HasValidAssetId() const;
 
+        /** Return index of the pooled session this asset has been instantiated in, or the session it **/
+        /** would be instantiated in if it has not been yet.                                         **/
+        int32 GetSessionIndex() const;
+
         /** Returns true if the asset is valid for cook/bake **/
         bool IsComponentValid() const;
 
         /** Invalidates the assets, causing it to be reinstantiated upon recook **/
         void NotifyAssetNeedsToBeReinstantiated();
 
+        /** Called when the session this asset lived in has been lost and restarted, reinstantiates the asset **/
+        /** and replays its parameters and inputs.                                                             **/
+        void NotifySessionRestarted();
+
         /** Return current referenced Houdini asset. **/
         UHoudiniAsset * GetHoudiniAsset() const;
 
@@ -455,6 +472,12 @@ public:
         /** Stop cooking / instantiation ticking. **/
         void StopHoudiniTicking();
 
+        /** Return priority of cook tasks, selected or visible assets cook first. **/
+        EHoudiniEngineTaskPriority::Type GetCookPriority() const;
+
+        /** Interrupt the cook in progress if its parameters are outdated. **/
+        void InterruptStaleCook();
+
         /** Start UI update ticking. **/
         void StartHoudiniUIUpdateTicking();
 
@@ -473,6 +496,14 @@ public:
         /** Start asset deletion task. **/
         void StartTaskAssetDeletion();
 
+        /** Return index of the pooled session this asset belongs to. Assets connected through asset **/
+        /** inputs share the session of their upstream asset.                                        **/
+        int32 ComputeSessionIndex() const;
+
+        /** Destroy the asset and its input nodes in the session it lives in, and reinstantiate it in **/
+        /** the session it now belongs to.                                                             **/
+        void MigrateToSession( int32 NewSessionIndex );
+
         /** Start asset cooking task. **/
         void StartTaskAssetCooking( bool bStartTicking = false );
 
@@ -590,6 +621,11 @@ public:
         /** Delete Static mesh resources. This will free static meshes and corresponding components. **/
         void ReleaseObjectGeoPartResources( bool bDeletePackages = false );
 
+        /** Move the components of stale meshes over to the meshes replacing them for the same geo part. **/
+        void ReuseStaticMeshComponents(
+            const TMap< FHoudiniGeoPartObject, UStaticMesh * > & StaleStaticMeshMap,
+            const TMap< FHoudiniGeoPartObject, UStaticMesh * > & NewStaticMeshMap );
+
         /** Check all the attached StaticMeshComponents to delete invalid ones **/
         void CleanUpAttachedStaticMeshComponents();
 
@@ -762,6 +798,9 @@ public:
         /** Id of corresponding Houdini asset. **/
         HAPI_NodeId AssetId;
 
+        /** Index of the session the asset has been instantiated in, INDEX_NONE if not instantiated. **/
+        int32 SessionIndex;
+
         /** Scale factor used for generated geometry of this component. **/
         float GeneratedGeometryScaleFactor;
 
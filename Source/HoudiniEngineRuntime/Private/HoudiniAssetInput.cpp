@@ -227,6 +227,7 @@ UHoudiniAssetInput::UHoudiniAssetInput( const FObjectInitializer & ObjectInitial
     bPackBeforeMerge = false;
     bExportAllLODs = false;
     bExportSockets = false;
+    bExportOutlinerAsInstances = false;
 
     ChoiceStringValue = TEXT( "" );
 
@@ -359,6 +360,9 @@ UHoudiniAssetInput::CreateWidgetResources()
 void
 UHoudiniAssetInput::DisconnectAndDestroyInputAsset()
 {
+    const UHoudiniAssetComponent * HoudiniAssetComponent = GetHoudiniAssetComponent();
+    FHoudiniEngineScopedSession ScopedSession( HoudiniAssetComponent ? HoudiniAssetComponent->GetSessionIndex() : 0 );
+
     if ( ChoiceIndex == EHoudiniAssetInputType::AssetInput )
     {
         if( bIsObjectPathParameter )
@@ -417,6 +421,10 @@ UHoudiniAssetInput::DisconnectAndDestroyInputAsset()
             }
         }
 
+        // Shared mesh uploads only merged by this input can go as well. This is deferred to the next tick, so
+        // an input which is rebuilt merges its meshes again instead of uploading them once more.
+        FHoudiniEngine::Get().ReleaseUnusedStaticMeshInputsDeferred();
+
         /*
         if ( ChoiceIndex == EHoudiniAssetInputType::WorldInput )
         {
@@ -871,7 +879,7 @@ UHoudiniAssetInput::UploadParameterValue()
                     // Connect input and create connected asset. Will return by reference.
                     if ( !FHoudiniEngineUtils::HapiCreateInputNodeForWorldOutliner(
                         HostAssetId, InputOutlinerMeshArray, ConnectedAssetId, CreatedInputDataAssetIds,
-                        UnrealSplineResolution, bExportAllLODs, bExportSockets ) )
+                        UnrealSplineResolution, bExportAllLODs, bExportSockets, bExportOutlinerAsInstances ) )
                     {
                         bChanged = false;
                         ConnectedAssetId = -1;
@@ -1546,7 +1554,7 @@ UHoudiniAssetInput::ChangeInputType(const EHoudiniAssetInputType::Enum& newType)
             if ( FHoudiniEngineUtils::HapiCreateInputNodeForWorldOutliner(
                 HostAssetId, InputOutlinerMeshArray,
                 ConnectedAssetId, CreatedInputDataAssetIds,
-                UnrealSplineResolution ) )
+                UnrealSplineResolution, bExportAllLODs, bExportSockets, bExportOutlinerAsInstances ) )
             {
                 ConnectInputNode();
             }
@@ -1733,6 +1741,9 @@ UHoudiniAssetInput::OnWorldOutlinerActorSelected( AActor * )
 void
 UHoudiniAssetInput::TickWorldOutlinerInputs()
 {
+    const UHoudiniAssetComponent * HoudiniAssetComponent = GetHoudiniAssetComponent();
+    FHoudiniEngineScopedSession ScopedSession( HoudiniAssetComponent ? HoudiniAssetComponent->GetSessionIndex() : 0 );
+
     // PostLoad initialization must be done on the first tick
     // as some components might now have been fully initialized at PostLoad()
     if ( OutlinerInputsNeedPostLoadInit )
@@ -1783,26 +1794,20 @@ UHoudiniAssetInput::TickWorldOutlinerInputs()
         if ( !OutlinerInput.ActorPtr.IsValid() )
             continue;
 
-        if ( OutlinerInput.HasActorTransformChanged() && ( OutlinerInput.AssetId >= 0 ) )
+        // Meshes are uploaded in local space, moving their component only moves the input's object.
+        bool bTransformOnlyChanged = OutlinerInput.HasActorTransformChanged();
+        if ( !bTransformOnlyChanged && !OutlinerInput.SplineComponent && ( OutlinerInput.KeepWorldTransform == bKeepWorldTransform ) )
+            bTransformOnlyChanged = OutlinerInput.HasComponentTransformChanged();
+
+        if ( bTransformOnlyChanged && ( OutlinerInput.AssetId >= 0 ) )
         {
             MarkLocalChanged();
 
             // Updates to the new Transform
             UpdateWorldOutlinerTransforms( OutlinerInput );
 
-            HAPI_TransformEuler HapiTransform;
-            FMemory::Memzero< HAPI_TransformEuler >( HapiTransform );
-            FHoudiniEngineUtils::TranslateUnrealTransform( OutlinerInput.ComponentTransform, HapiTransform );
-
-            HAPI_NodeInfo LocalAssetNodeInfo;
-            const HAPI_Result LocalResult = FHoudiniApi::GetNodeInfo(
-                FHoudiniEngine::Get().GetSession(), OutlinerInput.AssetId,
-                &LocalAssetNodeInfo);
-
-            if ( LocalResult == HAPI_RESULT_SUCCESS )
-                FHoudiniApi::SetObjectTransform(
-                    FHoudiniEngine::Get().GetSession(),
-                    LocalAssetNodeInfo.parentId, &HapiTransform );
+            // Only this entry's object is updated, the other input nodes are left untouched.
+            UploadWorldOutlinerTransform( OutlinerInput );
         }
         else if ( OutlinerInput.HasComponentTransformChanged() 
                 || ( OutlinerInput.HasSplineComponentChanged( UnrealSplineResolution ) )
@@ -1981,6 +1986,12 @@ UHoudiniAssetInput::GetConnectedInputAssetComponent()
     return InputAssetComponent;
 }
 
+const UHoudiniAssetComponent *
+UHoudiniAssetInput::GetConnectedInputAssetComponent() const
+{
+    return InputAssetComponent;
+}
+
 void
 UHoudiniAssetInput::NotifyChildParameterChanged( UHoudiniAssetParameter * HoudiniAssetParameter )
 {
@@ -2645,6 +2656,41 @@ UHoudiniAssetInput::IsCheckedExportSockets() const
     return ECheckBoxState::Unchecked;
 }
 
+void
+UHoudiniAssetInput::CheckStateChangedExportOutlinerAsInstances( ECheckBoxState NewState )
+{
+    int32 bState = ( NewState == ECheckBoxState::Checked );
+
+    if ( bExportOutlinerAsInstances == bState )
+        return;
+
+    // Record undo information.
+    FScopedTransaction Transaction(
+        TEXT( HOUDINI_MODULE_RUNTIME ),
+        LOCTEXT( "HoudiniInputChange", "Houdini Input export as instances changed." ),
+        PrimaryObject );
+    Modify();
+
+    MarkPreChanged();
+
+    bExportOutlinerAsInstances = bState;
+
+    // The outliner meshes need to be sent again.
+    bStaticMeshChanged = true;
+
+    // Mark this parameter as changed.
+    MarkChanged();
+}
+
+ECheckBoxState
+UHoudiniAssetInput::IsCheckedExportOutlinerAsInstances() const
+{
+    if ( bExportOutlinerAsInstances )
+        return ECheckBoxState::Checked;
+
+    return ECheckBoxState::Unchecked;
+}
+
 void
 UHoudiniAssetInput::CheckStateChangedPackBeforeMerge( ECheckBoxState NewState )
 {
@@ -2850,6 +2896,24 @@ UHoudiniAssetInput::UpdateWorldOutlinerTransforms( FHoudiniAssetInputOutlinerMes
     OutlinerMesh.KeepWorldTransform = bKeepWorldTransform;
 }
 
+void
+UHoudiniAssetInput::UploadWorldOutlinerTransform( const FHoudiniAssetInputOutlinerMesh& OutlinerMesh )
+{
+    HAPI_TransformEuler HapiTransform;
+    FMemory::Memzero< HAPI_TransformEuler >( HapiTransform );
+    FHoudiniEngineUtils::TranslateUnrealTransform( OutlinerMesh.ComponentTransform, HapiTransform );
+
+    HAPI_NodeInfo LocalAssetNodeInfo;
+    const HAPI_Result LocalResult = FHoudiniApi::GetNodeInfo(
+        FHoudiniEngine::Get().GetSession(), OutlinerMesh.AssetId,
+        &LocalAssetNodeInfo );
+
+    if ( LocalResult == HAPI_RESULT_SUCCESS )
+        FHoudiniApi::SetObjectTransform(
+            FHoudiniEngine::Get().GetSession(),
+            LocalAssetNodeInfo.parentId, &HapiTransform );
+}
+
 void UHoudiniAssetInput::OnAddToInputObjects()
 {
     FScopedTransaction Transaction(
@@ -3113,6 +3177,11 @@ UHoudiniAssetInput::UpdateInputOulinerArray()
         }
     }
 
+    // Shared mesh uploads of the removed actors may no longer be used. This is deferred to the next tick,
+    // once the updated actors have been recreated and merge the uploads they still reference.
+    if ( NeedsUpdate )
+        FHoudiniEngine::Get().ReleaseUnusedStaticMeshInputsDeferred();
+
     // Creates the inputs from the actors
     for ( auto & CurrentActor : ActorToUpdateArray )
         UpdateInputOulinerArrayFromActor( CurrentActor, true );
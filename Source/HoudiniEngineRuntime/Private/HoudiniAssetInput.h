@@ -196,6 +196,7 @@ class HOUDINIENGINERUNTIME_API UHoudiniAssetInput : public UHoudiniAssetParamete
 
         /** Get the HoudiniAssetComponent for the input asset. **/
         UHoudiniAssetComponent* GetConnectedInputAssetComponent();
+        const UHoudiniAssetComponent* GetConnectedInputAssetComponent() const;
         
         /** Invalidate all connected node ids */
         void InvalidateNodeIds();
@@ -298,6 +299,9 @@ class HOUDINIENGINERUNTIME_API UHoudiniAssetInput : public UHoudiniAssetParamete
         /** Update WorldOutliners Transform after they changed **/
         void UpdateWorldOutlinerTransforms(FHoudiniAssetInputOutlinerMesh& OutlinerMesh);
 
+        /** Upload the transform of a single world outliner input to its object node. **/
+        void UploadWorldOutlinerTransform( const FHoudiniAssetInputOutlinerMesh& OutlinerMesh );
+
         /** Removes invalid inputs or updates inputs with invalid components in InputOutlinerArray. **/
         /** Returns true when a change was made **/
         bool UpdateInputOulinerArray();
@@ -454,6 +458,12 @@ class HOUDINIENGINERUNTIME_API UHoudiniAssetInput : public UHoudiniAssetParamete
         /** Return checked state of export sockets checkbox. **/
         ECheckBoxState IsCheckedExportSockets() const;
 
+        /** Check if state of the export as instances checkbox has changed. **/
+        void CheckStateChangedExportOutlinerAsInstances( ECheckBoxState NewState );
+
+        /** Return checked state of export as instances checkbox. **/
+        ECheckBoxState IsCheckedExportOutlinerAsInstances() const;
+
         /** Handler for landscape recommit button. **/
         FReply OnButtonClickRecommit();
 
@@ -594,6 +604,9 @@ class HOUDINIENGINERUNTIME_API UHoudiniAssetInput : public UHoudiniAssetParamete
 
                 /** Indicates that all sockets in the input should be marshalled to Houdini **/
                 uint32 bExportSockets : 1;
+
+                /** Indicates that world outliner meshes are sent once and instanced by a point cloud **/
+                uint32 bExportOutlinerAsInstances : 1;
             };
 
             uint32 HoudiniAssetInputFlagsPacked;
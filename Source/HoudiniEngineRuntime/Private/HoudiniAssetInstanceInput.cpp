@@ -173,23 +173,17 @@ UHoudiniAssetInstanceInput::CreateInstanceInput()
             FHoudiniEngine::Get().GetSession(), HoudiniGeoPartObject.GeoId, PartInfo.id,
             InstancedPartIds.GetData(), 0, PartInfo.instancedPartCount ), false );
 
-        for ( auto InstancedPartId : InstancedPartIds )
+        // All the instanced parts share the instancer's transforms, so only convert them once.
+        TArray<FTransform> ObjectTransforms;
+        ObjectTransforms.SetNumUninitialized( InstancerPartTransforms.Num() );
+        for ( int32 InstanceIdx = 0; InstanceIdx < InstancerPartTransforms.Num(); ++InstanceIdx )
         {
-            HAPI_PartInfo InstancedPartInfo;
-            HOUDINI_CHECK_ERROR_RETURN(
-                FHoudiniApi::GetPartInfo(
-                    FHoudiniEngine::Get().GetSession(), HoudiniGeoPartObject.GeoId, InstancedPartId,
-                    &InstancedPartInfo ), false );
-
-            TArray<FTransform> ObjectTransforms;
-            ObjectTransforms.SetNumUninitialized( InstancerPartTransforms.Num() );
-            for ( int32 InstanceIdx = 0; InstanceIdx < InstancerPartTransforms.Num(); ++InstanceIdx )
-            {
-                const auto& InstanceTransform = InstancerPartTransforms[InstanceIdx];
-                FHoudiniEngineUtils::TranslateHapiTransform( InstanceTransform, ObjectTransforms[InstanceIdx] );
-                //HOUDINI_LOG_MESSAGE( TEXT( "Instance %d:%d Transform: %s for Part Id %d" ), HoudiniGeoPartObject.PartId, InstanceIdx, *ObjectTransforms[ InstanceIdx ].ToString(), InstancedPartId );
-            }
+            const auto& InstanceTransform = InstancerPartTransforms[InstanceIdx];
+            FHoudiniEngineUtils::TranslateHapiTransform( InstanceTransform, ObjectTransforms[InstanceIdx] );
+        }
 
+        for ( auto InstancedPartId : InstancedPartIds )
+        {
             // Create this instanced input field for this instanced part
             //
             FHoudiniGeoPartObject InstancedPart( HoudiniGeoPartObject.AssetId, HoudiniGeoPartObject.ObjectId, HoudiniGeoPartObject.GeoId, InstancedPartId );
@@ -527,39 +521,33 @@ UHoudiniAssetInstanceInput::CreateInstanceInputField(
             FHoudiniEngine::Get().GetSession(), InHoudiniGeoPartObject.GeoId, PartInfo.id,
             InstancedPartIds.GetData(), 0, PartInfo.instancedPartCount ) );
 
-        for ( auto InstancedPartId : InstancedPartIds )
+        TArray<FTransform> PPObjectTransforms;
+        PPObjectTransforms.SetNumUninitialized( InstancerPartTransforms.Num() );
+        for ( int32 InstanceIdx = 0; InstanceIdx < InstancerPartTransforms.Num(); ++InstanceIdx )
+        {
+            const auto& InstanceTransform = InstancerPartTransforms[InstanceIdx];
+            FHoudiniEngineUtils::TranslateHapiTransform( InstanceTransform, PPObjectTransforms[InstanceIdx] );
+        }
+
+        // Build the list of transforms for this instancer, it is the same for all the instanced parts.
+        TArray< FTransform > AllTransforms;
+        AllTransforms.Empty( PPObjectTransforms.Num() * ObjectTransforms.Num() );
+        for ( const FTransform& ObjectTransform : ObjectTransforms )
         {
-            HAPI_PartInfo InstancedPartInfo;
-            HOUDINI_CHECK_ERROR( &Result,
-                FHoudiniApi::GetPartInfo(
-                    FHoudiniEngine::Get().GetSession(), InHoudiniGeoPartObject.GeoId, InstancedPartId,
-                    &InstancedPartInfo ) );
-
-            TArray<FTransform> PPObjectTransforms;
-            PPObjectTransforms.SetNumUninitialized( InstancerPartTransforms.Num() );
-            for ( int32 InstanceIdx = 0; InstanceIdx < InstancerPartTransforms.Num(); ++InstanceIdx )
+            for ( const FTransform& PPTransform : PPObjectTransforms )
             {
-                const auto& InstanceTransform = InstancerPartTransforms[InstanceIdx];
-                FHoudiniEngineUtils::TranslateHapiTransform( InstanceTransform, PPObjectTransforms[InstanceIdx] );
+                AllTransforms.Add( PPTransform * ObjectTransform );
             }
+        }
 
+        for ( auto InstancedPartId : InstancedPartIds )
+        {
             // Create this instanced input field for this instanced part
             
             // find static mesh for this instancer
             FHoudiniGeoPartObject TempInstancedPart( InHoudiniGeoPartObject.AssetId, InHoudiniGeoPartObject.ObjectId, InHoudiniGeoPartObject.GeoId, InstancedPartId );
             if ( UStaticMesh* FoundStaticMesh = Comp->LocateStaticMesh( TempInstancedPart, false ) )
             {
-                // Build the list of transforms for this instancer
-                TArray< FTransform > AllTransforms;
-                AllTransforms.Empty( PPObjectTransforms.Num() * ObjectTransforms.Num() );
-                for ( const FTransform& ObjectTransform : ObjectTransforms )
-                {
-                    for ( const FTransform& PPTransform : PPObjectTransforms )
-                    {
-                        AllTransforms.Add( PPTransform * ObjectTransform );
-                    }
-                }
-
                 CreateInstanceInputField( FoundStaticMesh, AllTransforms, InstanceInputFields, NewInstanceInputFields );
             }
             else
@@ -78,6 +78,11 @@ UHoudiniAssetParameterButton::CreateParameter(
 bool
 UHoudiniAssetParameterButton::UploadParameterValue()
 {
+    // Buttons can be pressed from the details panel, outside of the session scope of their asset.
+    const UHoudiniAssetComponent * HoudiniAssetComponent = Cast< UHoudiniAssetComponent >( PrimaryObject );
+    FHoudiniEngineScopedSession ScopedSession(
+        HoudiniAssetComponent ? HoudiniAssetComponent->GetSessionIndex() : FHoudiniEngine::GetBoundSessionIndex() );
+
     int32 PressValue = 1;
     if ( FHoudiniApi::SetParmIntValues(
         FHoudiniEngine::Get().GetSession(), NodeId, &PressValue, ValuesIndex, 1 ) != HAPI_RESULT_SUCCESS )
@@ -30,6 +30,7 @@
 #include "HoudiniEngineUtils.h"
 #include "HoudiniLandscapeUtils.h"
 #include "HoudiniAsset.h"
+#include "HoudiniAssetComponent.h"
 #include "HoudiniRuntimeSettings.h"
 
 #include "PlatformMisc.h"
@@ -37,6 +38,8 @@
 #include "ScopeLock.h"
 #include "SlateApplication.h"
 #include "Materials/Material.h"
+#include "Async/Async.h"
+#include "UObject/UObjectIterator.h"
 
 #include "Internationalization.h"
 
@@ -51,16 +54,24 @@ DEFINE_LOG_CATEGORY( LogHoudiniEngine );
 FHoudiniEngine *
 FHoudiniEngine::HoudiniEngineInstance = nullptr;
 
+uint32
+FHoudiniEngine::SessionTlsSlot = 0xFFFFFFFF;
+
 FHoudiniEngine::FHoudiniEngine()
     : HoudiniLogoStaticMesh( nullptr )
     , HoudiniDefaultMaterial( nullptr )
     , HoudiniBgeoAsset( nullptr )
-    , HoudiniEngineSchedulerThread( nullptr )
-    , HoudiniEngineScheduler( nullptr )
     , EnableCookingGlobal( true )
+    , bWarmUpSessionsInBackground( false )
+    , bSessionsWarmingUp( false )
+    , SessionWarmUpThreadId( 0 )
 {
-    Session.type = HAPI_SESSION_MAX;
-    Session.id = -1;
+    // Main session always exists, pooled sessions are added on startup.
+    Sessions.SetNum( 1 );
+    Sessions[ 0 ].type = HAPI_SESSION_MAX;
+    Sessions[ 0 ].id = -1;
+    AssetLibraries.SetNum( 1 );
+    StaticMeshInputs.SetNum( 1 );
 }
 
 #if WITH_EDITOR
@@ -118,9 +129,64 @@ FHoudiniEngine::SetHapiState( HAPI_Result Result )
 const HAPI_Session *
 FHoudiniEngine::GetSession() const
 {
+    return GetSession( FHoudiniEngine::GetBoundSessionIndex() );
+}
+
+const HAPI_Session *
+FHoudiniEngine::GetSession( int32 SessionIndex ) const
+{
+    // Unknown session indices fall back to the main session.
+    if ( !Sessions.IsValidIndex( SessionIndex ) )
+        SessionIndex = 0;
+
+    // Sessions are only usable by the warm-up thread until they are ready.
+    if ( bSessionsWarmingUp && FPlatformTLS::GetCurrentThreadId() != SessionWarmUpThreadId )
+        return nullptr;
+
+    const HAPI_Session & Session = Sessions[ SessionIndex ];
     return Session.type == HAPI_SESSION_MAX ? nullptr : &Session;
 }
 
+int32
+FHoudiniEngine::GetSessionCount() const
+{
+    return Sessions.Num();
+}
+
+int32
+FHoudiniEngine::GetSessionIndexForGuid( const FGuid & Guid ) const
+{
+    if ( Sessions.Num() <= 1 || !Guid.IsValid() )
+        return 0;
+
+    // Pick a session which has been successfully created, starting from the hashed one.
+    const int32 HashedIndex = GetTypeHash( Guid ) % (uint32) Sessions.Num();
+    for ( int32 Offset = 0; Offset < Sessions.Num(); ++Offset )
+    {
+        int32 SessionIndex = ( HashedIndex + Offset ) % Sessions.Num();
+        if ( Sessions[ SessionIndex ].type != HAPI_SESSION_MAX )
+            return SessionIndex;
+    }
+
+    return 0;
+}
+
+int32
+FHoudiniEngine::GetBoundSessionIndex()
+{
+    if ( !FPlatformTLS::IsValidTlsSlot( FHoudiniEngine::SessionTlsSlot ) )
+        return 0;
+
+    return (int32)(UPTRINT) FPlatformTLS::GetTlsValue( FHoudiniEngine::SessionTlsSlot );
+}
+
+void
+FHoudiniEngine::SetBoundSessionIndex( int32 SessionIndex )
+{
+    if ( FPlatformTLS::IsValidTlsSlot( FHoudiniEngine::SessionTlsSlot ) )
+        FPlatformTLS::SetTlsValue( FHoudiniEngine::SessionTlsSlot, (void *)(UPTRINT) SessionIndex );
+}
+
 FHoudiniEngine &
 FHoudiniEngine::Get()
 {
@@ -134,6 +200,12 @@ FHoudiniEngine::IsInitialized()
     return FHoudiniEngine::HoudiniEngineInstance != nullptr && FHoudiniEngineUtils::IsInitialized();
 }
 
+bool
+FHoudiniEngine::IsLoaded()
+{
+    return FHoudiniEngine::HoudiniEngineInstance != nullptr;
+}
+
 void
 FHoudiniEngine::StartupModule()
 {
@@ -142,6 +214,10 @@ FHoudiniEngine::StartupModule()
 
     HOUDINI_LOG_MESSAGE( TEXT( "Starting the Houdini Engine module." ) );
 
+    // Allocate slot used to bind threads to sessions of the pool.
+    if ( !FPlatformTLS::IsValidTlsSlot( FHoudiniEngine::SessionTlsSlot ) )
+        FHoudiniEngine::SessionTlsSlot = FPlatformTLS::AllocTlsSlot();
+
 #if WITH_EDITOR
     // Register settings.
     if( ISettingsModule * SettingsModule = FModuleManager::GetModulePtr< ISettingsModule >( "Settings" ) )
@@ -225,353 +301,109 @@ FHoudiniEngine::StartupModule()
     {
         const UHoudiniRuntimeSettings * HoudiniRuntimeSettings = GetDefault< UHoudiniRuntimeSettings >();
 
-        HAPI_Result SessionResult = HAPI_RESULT_FAILURE;
-
-        HAPI_ThriftServerOptions ServerOptions;
-        FMemory::Memzero< HAPI_ThriftServerOptions >( ServerOptions );
-        ServerOptions.autoClose = true;
-        ServerOptions.timeoutMs = HoudiniRuntimeSettings->AutomaticServerTimeout;
-
-        auto UpdatePathForServer = [&] {
-            // Modify our PATH so that HARC will find HARS.exe
-            const TCHAR* PathDelimiter = FPlatformMisc::GetPathVarDelimiter();
-            const int32 MaxPathVarLen = 32768;
-            TCHAR OrigPathVarMem[ MaxPathVarLen ];
-            FPlatformMisc::GetEnvironmentVariable( TEXT( "PATH" ), OrigPathVarMem, MaxPathVarLen );
-            FString OrigPathVar( OrigPathVarMem );
-
-            FString ModifiedPath =
-#if PLATFORM_MAC
-            // On Mac our binaries are split between two folders
-            LibHAPILocation + TEXT( "/../Resources/bin" ) + PathDelimiter +
-#endif
-            LibHAPILocation + PathDelimiter + OrigPathVar;
-
-            FPlatformMisc::SetEnvironmentVar( TEXT( "PATH" ), *ModifiedPath );
-        };
-
-        switch ( HoudiniRuntimeSettings->SessionType.GetValue() )
+        // Size the session pool, only out of process sessions can be pooled.
+        int32 SessionPoolSize = FMath::Clamp( HoudiniRuntimeSettings->SessionPoolSize, 1, HAPI_UNREAL_SESSION_POOL_SIZE_MAX );
+        if ( SessionPoolSize > 1 && HoudiniRuntimeSettings->SessionType.GetValue() == EHoudiniRuntimeSettingsSessionType::HRSST_InProcess )
         {
-            case EHoudiniRuntimeSettingsSessionType::HRSST_InProcess:
-            {
-                SessionResult = FHoudiniApi::CreateInProcessSession( &this->Session );
-#if PLATFORM_WINDOWS
-                // Workaround for Houdini libtools setting stdout to binary
-                FWindowsPlatformMisc::SetUTF8Output();
-#endif
-                break;
-            }
-
-            case EHoudiniRuntimeSettingsSessionType::HRSST_Socket:
-            {
-                if ( HoudiniRuntimeSettings->bStartAutomaticServer )
-                {
-                    UpdatePathForServer();
-
-                    FHoudiniApi::StartThriftSocketServer( &ServerOptions, HoudiniRuntimeSettings->ServerPort, nullptr );
-                }
-
-                SessionResult = FHoudiniApi::CreateThriftSocketSession(
-                    &this->Session,
-                    TCHAR_TO_UTF8( *HoudiniRuntimeSettings->ServerHost ),
-                    HoudiniRuntimeSettings->ServerPort );
-
-                break;
-            }
-
-            case EHoudiniRuntimeSettingsSessionType::HRSST_NamedPipe:
-            {
-                if ( HoudiniRuntimeSettings->bStartAutomaticServer )
-                {
-                    UpdatePathForServer();
-
-                    FHoudiniApi::StartThriftNamedPipeServer(
-                        &ServerOptions,
-                        TCHAR_TO_UTF8( *HoudiniRuntimeSettings->ServerPipeName ),
-                        nullptr );
-                }
-
-                SessionResult = FHoudiniApi::CreateThriftNamedPipeSession(
-                    &this->Session, TCHAR_TO_UTF8( *HoudiniRuntimeSettings->ServerPipeName ) );
-
-                break;
-            }
-
-            default:
-
-                HOUDINI_LOG_ERROR( TEXT( "Unsupported Houdini Engine session type" ) );
+            HOUDINI_LOG_WARNING( TEXT( "Session pool requires a socket or named pipe session, using a single session." ) );
+            SessionPoolSize = 1;
         }
 
-        const HAPI_Session * SessionPtr = GetSession();
-        if ( SessionResult != HAPI_RESULT_SUCCESS || !SessionPtr )
+        Sessions.SetNum( SessionPoolSize );
+        AssetLibraries.SetNum( SessionPoolSize );
+        StaticMeshInputs.SetNum( SessionPoolSize );
+        for ( int32 SessionIndex = 0; SessionIndex < SessionPoolSize; ++SessionIndex )
         {
-            if ( ( HoudiniRuntimeSettings->SessionType.GetValue() == EHoudiniRuntimeSettingsSessionType::HRSST_Socket ||
-                HoudiniRuntimeSettings->SessionType.GetValue() == EHoudiniRuntimeSettingsSessionType::HRSST_NamedPipe ) &&
-                ! HoudiniRuntimeSettings->bStartAutomaticServer )
-            {
-                HOUDINI_LOG_ERROR( TEXT( "Failed to create a Houdini Engine session.  Check that a Houdini Engine Debugger session or HARS server is running" ) );
-            }
-            else
-            {
-                HOUDINI_LOG_ERROR( TEXT( "Failed to create a Houdini Engine session" ) );
-            }
+            Sessions[ SessionIndex ].type = HAPI_SESSION_MAX;
+            Sessions[ SessionIndex ].id = -1;
         }
 
-        // We need to make sure HAPI version is correct.
-        int32 RunningEngineMajor = 0;
-        int32 RunningEngineMinor = 0;
-        int32 RunningEngineApi = 0;
-
-        // Retrieve version numbers for running Houdini Engine.
-        FHoudiniApi::GetEnvInt( HAPI_ENVINT_VERSION_HOUDINI_ENGINE_MAJOR, &RunningEngineMajor );
-        FHoudiniApi::GetEnvInt( HAPI_ENVINT_VERSION_HOUDINI_ENGINE_MINOR, &RunningEngineMinor );
-        FHoudiniApi::GetEnvInt( HAPI_ENVINT_VERSION_HOUDINI_ENGINE_API, &RunningEngineApi );
-
-        // Compare defined and running versions.
-        if ( RunningEngineMajor == HAPI_VERSION_HOUDINI_ENGINE_MAJOR &&
-           RunningEngineMinor == HAPI_VERSION_HOUDINI_ENGINE_MINOR &&
-           RunningEngineApi == HAPI_VERSION_HOUDINI_ENGINE_API )
-        {
-            HAPI_CookOptions CookOptions;
-            FMemory::Memzero< HAPI_CookOptions >( CookOptions );
-            CookOptions.curveRefineLOD = 8.0f;
-            CookOptions.clearErrorsAndWarnings = false;
-            CookOptions.maxVerticesPerPrimitive = 3;
-            CookOptions.splitGeosByGroup = false;
-            CookOptions.refineCurveToLinear = true;
-            CookOptions.handleBoxPartTypes = false;
-            CookOptions.handleSpherePartTypes = false;
-            CookOptions.splitPointsByVertexAttributes = false;
-            CookOptions.packedPrimInstancingMode = HAPI_PACKEDPRIM_INSTANCING_MODE_FLAT;
-
-            HAPI_Result Result = FHoudiniApi::Initialize( SessionPtr, &CookOptions, true,
-                HoudiniRuntimeSettings->CookingThreadStackSize, 
-                TCHAR_TO_UTF8( *HoudiniRuntimeSettings->HoudiniEnvironmentFiles),
-                TCHAR_TO_UTF8( *HoudiniRuntimeSettings->OtlSearchPath), 
-                TCHAR_TO_UTF8( *HoudiniRuntimeSettings->DsoSearchPath),
-                TCHAR_TO_UTF8( *HoudiniRuntimeSettings->ImageDsoSearchPath), 
-                TCHAR_TO_UTF8( *HoudiniRuntimeSettings->AudioDsoSearchPath) );
-            if ( Result == HAPI_RESULT_SUCCESS )
-            {
-                HOUDINI_LOG_MESSAGE( TEXT( "Successfully intialized the Houdini Engine API module." ) );
-                FHoudiniApi::SetServerEnvString( SessionPtr, HAPI_ENV_CLIENT_NAME, HAPI_UNREAL_CLIENT_NAME );
-            }
-            else
-            {
-                HOUDINI_LOG_MESSAGE(
-                    TEXT( "Starting up the Houdini Engine API module failed: %s" ),
-                    *FHoudiniEngineUtils::GetErrorDescription( Result ) );
-            }
-        }
-        else
+        // Out of process sessions are warmed up in the background, so editor startup is not blocked
+        // by the server start and HAPI initialization. Commandlets need the session right away.
+        bWarmUpSessionsInBackground = HoudiniRuntimeSettings->SessionType.GetValue() != EHoudiniRuntimeSettingsSessionType::HRSST_InProcess
+            && !IsRunningCommandlet();
+
+        if ( bWarmUpSessionsInBackground )
+            bSessionsWarmingUp = true;
+
+        // Create HAPI schedulers and processing threads, one per session of the pool.
+        for ( int32 SessionIndex = 0; SessionIndex < Sessions.Num(); ++SessionIndex )
         {
-            bHAPIVersionMismatch = true;
+            FString ThreadName = SessionIndex == 0 ?
+                FString( TEXT( "HoudiniTaskCookAsset" ) ) : FString::Printf( TEXT( "HoudiniTaskCookAsset%d" ), SessionIndex );
 
-            HOUDINI_LOG_MESSAGE( TEXT( "Starting up the Houdini Engine API module failed: build and running versions do not match." ) );
-            HOUDINI_LOG_MESSAGE(
-                TEXT( "Defined version: %d.%d.api:%d vs Running version: %d.%d.api:%d" ),
-                HAPI_VERSION_HOUDINI_ENGINE_MAJOR, HAPI_VERSION_HOUDINI_ENGINE_MINOR, HAPI_VERSION_HOUDINI_ENGINE_API,
-                RunningEngineMajor, RunningEngineMinor, RunningEngineApi );
+            FHoudiniEngineScheduler * HoudiniEngineScheduler = new FHoudiniEngineScheduler( SessionIndex );
+            HoudiniEngineSchedulers.Add( HoudiniEngineScheduler );
+            HoudiniEngineSchedulerThreads.Add( FRunnableThread::Create(
+                HoudiniEngineScheduler, *ThreadName, 0, TPri_Normal ) );
         }
 
-        // Create HAPI scheduler and processing thread.
-        HoudiniEngineScheduler = new FHoudiniEngineScheduler();
-        HoudiniEngineSchedulerThread = FRunnableThread::Create(
-            HoudiniEngineScheduler, TEXT( "HoudiniTaskCookAsset" ), 0, TPri_Normal );
-
         // Set the default value for pausing houdini engine cooking
         EnableCookingGlobal = !HoudiniRuntimeSettings->bPauseCookingOnStart;
     }
 
 #endif
 
-    // Store the instance.
-    FHoudiniEngine::HoudiniEngineInstance = this;
-}
-
-void
-FHoudiniEngine::ShutdownModule()
-{
-    HOUDINI_LOG_MESSAGE( TEXT( "Shutting down the Houdini Engine module." ) );
-
-    // We no longer need Houdini logo static mesh.
-    if ( HoudiniLogoStaticMesh.IsValid() )
-    {
-        HoudiniLogoStaticMesh->RemoveFromRoot();
-        HoudiniLogoStaticMesh = nullptr;
-    }
+    // Register ticker used to notify components of finished tasks on the next frame.
+    CompletedTasksTickerHandle = FTicker::GetCoreTicker().AddTicker(
+        FTickerDelegate::CreateRaw( this, &FHoudiniEngine::TickTasks ) );
 
-    // We no longer need Houdini default material.
-    if ( HoudiniDefaultMaterial.IsValid() )
-    {
-        HoudiniDefaultMaterial->RemoveFromRoot();
-        HoudiniDefaultMaterial = nullptr;
-    }
+#if WITH_EDITOR
 
-    // We no longer need Houdini digital asset used for loading bgeo files.
-    if ( HoudiniBgeoAsset.IsValid() )
+    // Register ticker used to detect and recover lost sessions.
+    const float SessionWatchdogInterval = GetDefault< UHoudiniRuntimeSettings >()->SessionWatchdogInterval;
+    if ( SessionWatchdogInterval > 0.0f && !IsRunningCommandlet() )
     {
-        HoudiniBgeoAsset->RemoveFromRoot();
-        HoudiniBgeoAsset = nullptr;
+        SessionWatchdogTickerHandle = FTicker::GetCoreTicker().AddTicker(
+            FTickerDelegate::CreateRaw( this, &FHoudiniEngine::TickSessionWatchdog ), SessionWatchdogInterval );
     }
 
-#if WITH_EDITOR
-    // Unregister settings.
-    ISettingsModule * SettingsModule = FModuleManager::GetModulePtr< ISettingsModule >( "Settings" );
-    if ( SettingsModule )
-        SettingsModule->UnregisterSettings( "Project", "Plugins", "HoudiniEngine" );
 #endif
 
-    // Do scheduler and thread clean up.
-    if ( HoudiniEngineScheduler )
-        HoudiniEngineScheduler->Stop();
-
-    if ( HoudiniEngineSchedulerThread )
-    {
-        //HoudiniEngineSchedulerThread->Kill( true );
-        HoudiniEngineSchedulerThread->WaitForCompletion();
-
-        delete HoudiniEngineSchedulerThread;
-        HoudiniEngineSchedulerThread = nullptr;
-    }
+    // Store the instance.
+    FHoudiniEngine::HoudiniEngineInstance = this;
 
-    if ( HoudiniEngineScheduler )
-    {
-        delete HoudiniEngineScheduler;
-        HoudiniEngineScheduler = nullptr;
-    }
+#if WITH_EDITOR
 
-    // Perform HAPI finalization.
+    // Create and initialize the sessions, now that the instance is available.
     if ( FHoudiniApi::IsHAPIInitialized() )
-        FHoudiniApi::Cleanup( GetSession() );
-
-    FHoudiniApi::FinalizeHAPI();
-}
-
-void
-FHoudiniEngine::AddTask( const FHoudiniEngineTask & Task )
-{
-    if ( HoudiniEngineScheduler )
-        HoudiniEngineScheduler->AddTask( Task );
-
-    FScopeLock ScopeLock( &CriticalSection );
-    FHoudiniEngineTaskInfo TaskInfo;
-    TaskInfos.Add( Task.HapiGUID, TaskInfo );
-}
-
-void
-FHoudiniEngine::AddTaskInfo( const FGuid HapIGUID, const FHoudiniEngineTaskInfo & TaskInfo )
-{
-    FScopeLock ScopeLock( &CriticalSection );
-    TaskInfos.Add( HapIGUID, TaskInfo );
-}
-
-void
-FHoudiniEngine::RemoveTaskInfo( const FGuid HapIGUID )
-{
-    FScopeLock ScopeLock( &CriticalSection );
-    TaskInfos.Remove( HapIGUID );
-}
-
-bool
-FHoudiniEngine::RetrieveTaskInfo( const FGuid HapIGUID, FHoudiniEngineTaskInfo & TaskInfo )
-{
-    FScopeLock ScopeLock( &CriticalSection );
-
-    if ( TaskInfos.Contains( HapIGUID ) )
-    {
-        TaskInfo = TaskInfos[ HapIGUID ];
-        return true;
-    }
-
-    return false;
-}
-
-bool 
-FHoudiniEngine::CookNode(
-    HAPI_NodeId AssetId, FHoudiniCookParams& HoudiniCookParams,
-    bool ForceRebuildStaticMesh, bool ForceRecookAll,
-    const TMap< FHoudiniGeoPartObject, UStaticMesh * > & StaticMeshesIn,
-    TMap< FHoudiniGeoPartObject, UStaticMesh * > & StaticMeshesOut,
-    TMap< FHoudiniGeoPartObject, ALandscape * >& LandscapesIn,
-    TMap< FHoudiniGeoPartObject, ALandscape * >& LandscapesOut,
-    FTransform & ComponentTransform )
-{
-    // 
-    TMap< FHoudiniGeoPartObject, UStaticMesh * > CookResultArray;
-    bool bReturn = FHoudiniEngineUtils::CreateStaticMeshesFromHoudiniAsset(
-        AssetId, HoudiniCookParams, ForceRebuildStaticMesh, 
-        ForceRecookAll, StaticMeshesIn, CookResultArray, ComponentTransform );
-
-    if ( !bReturn )
-        return false;
-
-    // Extract the static mesh and the volumes/heightfields from the CookResultArray
-    TArray< FHoudiniGeoPartObject > FoundVolumes;
-    for ( TMap< FHoudiniGeoPartObject, UStaticMesh * >::TIterator Iter( CookResultArray ); Iter; ++Iter )
     {
-        const FHoudiniGeoPartObject HoudiniGeoPartObject = Iter.Key();
-        UStaticMesh * StaticMesh = Iter.Value();
-
-        if ( HoudiniGeoPartObject.IsInstancer() )
-            continue;
-        else if (HoudiniGeoPartObject.IsPackedPrimitiveInstancer())
-            continue;
-        else if (HoudiniGeoPartObject.IsCurve())
-            continue;
-        else if (HoudiniGeoPartObject.IsVolume())
+        if ( bWarmUpSessionsInBackground )
         {
-            FoundVolumes.Add( HoudiniGeoPartObject );
+            SessionWarmUpFuture = Async< void >( EAsyncExecution::Thread, [ this ]()
+            {
+                SessionWarmUpThreadId = FPlatformTLS::GetCurrentThreadId();
+                WarmUpSessions();
+                bSessionsWarmingUp = false;
+
+                HOUDINI_LOG_MESSAGE( TEXT( "Houdini Engine sessions are ready." ) );
+            } );
         }
         else
         {
-            StaticMeshesOut.Add( HoudiniGeoPartObject, StaticMesh );
+            WarmUpSessions();
         }
     }
-#if WITH_EDITOR
-    // The meshes are already created but we need to create the landscape too
-    if ( FoundVolumes.Num() > 0 )
-        bReturn = FHoudiniLandscapeUtils::CreateAllLandscapes( HoudiniCookParams, FoundVolumes, LandscapesIn, LandscapesOut, -200.0f, 200.0f );
-#endif
-
-    return bReturn;
-}
 
-void 
-FHoudiniEngine::SetEnableCookingGlobal(const bool& enableCooking)
-{
-    EnableCookingGlobal = enableCooking;
-}
-
-bool
-FHoudiniEngine::GetEnableCookingGlobal()
-{
-    return EnableCookingGlobal;
+#endif
 }
 
-
-bool
-FHoudiniEngine::StartSession( HAPI_Session*& SessionPtr )
+void
+FHoudiniEngine::WarmUpSessions()
 {
-    // HAPI needs to be initialized
-    if ( !FHoudiniApi::IsHAPIInitialized() )
-        return false;
-
-    // Only start a new Session if we dont have a valid one
-    if ( HAPI_RESULT_SUCCESS == FHoudiniApi::IsSessionValid( SessionPtr ) )
-        return true;
+#if WITH_EDITOR
 
     const UHoudiniRuntimeSettings * HoudiniRuntimeSettings = GetDefault< UHoudiniRuntimeSettings >();
 
     HAPI_Result SessionResult = HAPI_RESULT_FAILURE;
+    HAPI_Session & Session = Sessions[ 0 ];
 
     HAPI_ThriftServerOptions ServerOptions;
     FMemory::Memzero< HAPI_ThriftServerOptions >( ServerOptions );
     ServerOptions.autoClose = true;
     ServerOptions.timeoutMs = HoudiniRuntimeSettings->AutomaticServerTimeout;
 
-    auto UpdatePathForServer = [&]
-    {
+    auto UpdatePathForServer = [&] {
         // Modify our PATH so that HARC will find HARS.exe
         const TCHAR* PathDelimiter = FPlatformMisc::GetPathVarDelimiter();
         const int32 MaxPathVarLen = 32768;
@@ -593,7 +425,7 @@ FHoudiniEngine::StartSession( HAPI_Session*& SessionPtr )
     {
         case EHoudiniRuntimeSettingsSessionType::HRSST_InProcess:
         {
-            SessionResult = FHoudiniApi::CreateInProcessSession( SessionPtr );
+            SessionResult = FHoudiniApi::CreateInProcessSession( &Session );
 #if PLATFORM_WINDOWS
             // Workaround for Houdini libtools setting stdout to binary
             FWindowsPlatformMisc::SetUTF8Output();
@@ -606,37 +438,47 @@ FHoudiniEngine::StartSession( HAPI_Session*& SessionPtr )
             if ( HoudiniRuntimeSettings->bStartAutomaticServer )
             {
                 UpdatePathForServer();
-                FHoudiniApi::StartThriftSocketServer(
-                    &ServerOptions, HoudiniRuntimeSettings->ServerPort, nullptr );
+
+                FHoudiniApi::StartThriftSocketServer( &ServerOptions, HoudiniRuntimeSettings->ServerPort, nullptr );
             }
 
             SessionResult = FHoudiniApi::CreateThriftSocketSession(
-                SessionPtr, TCHAR_TO_UTF8( *HoudiniRuntimeSettings->ServerHost ), HoudiniRuntimeSettings->ServerPort );
+                &Session,
+                TCHAR_TO_UTF8( *HoudiniRuntimeSettings->ServerHost ),
+                HoudiniRuntimeSettings->ServerPort );
+
+            break;
         }
-        break;
 
         case EHoudiniRuntimeSettingsSessionType::HRSST_NamedPipe:
         {
             if ( HoudiniRuntimeSettings->bStartAutomaticServer )
             {
                 UpdatePathForServer();
+
                 FHoudiniApi::StartThriftNamedPipeServer(
-                    &ServerOptions, TCHAR_TO_UTF8( *HoudiniRuntimeSettings->ServerPipeName ), nullptr );
+                    &ServerOptions,
+                    TCHAR_TO_UTF8( *HoudiniRuntimeSettings->ServerPipeName ),
+                    nullptr );
             }
 
             SessionResult = FHoudiniApi::CreateThriftNamedPipeSession(
-                SessionPtr, TCHAR_TO_UTF8( *HoudiniRuntimeSettings->ServerPipeName ) );
+                &Session, TCHAR_TO_UTF8( *HoudiniRuntimeSettings->ServerPipeName ) );
+
+            break;
         }
-        break;
 
         default:
+
             HOUDINI_LOG_ERROR( TEXT( "Unsupported Houdini Engine session type" ) );
-            break;
     }
 
+    const HAPI_Session * SessionPtr = GetSession( 0 );
     if ( SessionResult != HAPI_RESULT_SUCCESS || !SessionPtr )
     {
-        if ( !HoudiniRuntimeSettings->bStartAutomaticServer )
+        if ( ( HoudiniRuntimeSettings->SessionType.GetValue() == EHoudiniRuntimeSettingsSessionType::HRSST_Socket ||
+            HoudiniRuntimeSettings->SessionType.GetValue() == EHoudiniRuntimeSettingsSessionType::HRSST_NamedPipe ) &&
+            ! HoudiniRuntimeSettings->bStartAutomaticServer )
         {
             HOUDINI_LOG_ERROR( TEXT( "Failed to create a Houdini Engine session.  Check that a Houdini Engine Debugger session or HARS server is running" ) );
         }
@@ -644,11 +486,8 @@ FHoudiniEngine::StartSession( HAPI_Session*& SessionPtr )
         {
             HOUDINI_LOG_ERROR( TEXT( "Failed to create a Houdini Engine session" ) );
         }
-
-        return false;
     }
 
-    // Now, initialize HAPI with the new session
     // We need to make sure HAPI version is correct.
     int32 RunningEngineMajor = 0;
     int32 RunningEngineMinor = 0;
@@ -660,9 +499,608 @@ FHoudiniEngine::StartSession( HAPI_Session*& SessionPtr )
     FHoudiniApi::GetEnvInt( HAPI_ENVINT_VERSION_HOUDINI_ENGINE_API, &RunningEngineApi );
 
     // Compare defined and running versions.
-    if ( RunningEngineMajor != HAPI_VERSION_HOUDINI_ENGINE_MAJOR
-        || RunningEngineMinor != HAPI_VERSION_HOUDINI_ENGINE_MINOR
-        || RunningEngineApi != HAPI_VERSION_HOUDINI_ENGINE_API )
+    if ( RunningEngineMajor == HAPI_VERSION_HOUDINI_ENGINE_MAJOR &&
+       RunningEngineMinor == HAPI_VERSION_HOUDINI_ENGINE_MINOR &&
+       RunningEngineApi == HAPI_VERSION_HOUDINI_ENGINE_API )
+    {
+        HAPI_CookOptions CookOptions;
+        FMemory::Memzero< HAPI_CookOptions >( CookOptions );
+        CookOptions.curveRefineLOD = 8.0f;
+        CookOptions.clearErrorsAndWarnings = false;
+        CookOptions.maxVerticesPerPrimitive = 3;
+        CookOptions.splitGeosByGroup = false;
+        CookOptions.refineCurveToLinear = true;
+        CookOptions.handleBoxPartTypes = false;
+        CookOptions.handleSpherePartTypes = false;
+        CookOptions.splitPointsByVertexAttributes = false;
+        CookOptions.packedPrimInstancingMode = HAPI_PACKEDPRIM_INSTANCING_MODE_FLAT;
+
+        HAPI_Result Result = FHoudiniApi::Initialize( SessionPtr, &CookOptions, true,
+            HoudiniRuntimeSettings->CookingThreadStackSize, 
+            TCHAR_TO_UTF8( *HoudiniRuntimeSettings->HoudiniEnvironmentFiles),
+            TCHAR_TO_UTF8( *HoudiniRuntimeSettings->OtlSearchPath), 
+            TCHAR_TO_UTF8( *HoudiniRuntimeSettings->DsoSearchPath),
+            TCHAR_TO_UTF8( *HoudiniRuntimeSettings->ImageDsoSearchPath), 
+            TCHAR_TO_UTF8( *HoudiniRuntimeSettings->AudioDsoSearchPath) );
+        if ( Result == HAPI_RESULT_SUCCESS )
+        {
+            HOUDINI_LOG_MESSAGE( TEXT( "Successfully intialized the Houdini Engine API module." ) );
+            FHoudiniApi::SetServerEnvString( SessionPtr, HAPI_ENV_CLIENT_NAME, HAPI_UNREAL_CLIENT_NAME );
+
+            // Create additional sessions of the pool.
+            for ( int32 SessionIndex = 1; SessionIndex < Sessions.Num(); ++SessionIndex )
+            {
+                HAPI_Session * PooledSessionPtr = &Sessions[ SessionIndex ];
+                if ( !StartSession( PooledSessionPtr, SessionIndex ) )
+                {
+                    HOUDINI_LOG_WARNING( TEXT( "Failed to create pooled Houdini Engine session %d." ), SessionIndex );
+                    Sessions[ SessionIndex ].type = HAPI_SESSION_MAX;
+                }
+            }
+        }
+        else
+        {
+            HOUDINI_LOG_MESSAGE(
+                TEXT( "Starting up the Houdini Engine API module failed: %s" ),
+                *FHoudiniEngineUtils::GetErrorDescription( Result ) );
+        }
+    }
+    else
+    {
+        bHAPIVersionMismatch = true;
+
+        HOUDINI_LOG_MESSAGE( TEXT( "Starting up the Houdini Engine API module failed: build and running versions do not match." ) );
+        HOUDINI_LOG_MESSAGE(
+            TEXT( "Defined version: %d.%d.api:%d vs Running version: %d.%d.api:%d" ),
+            HAPI_VERSION_HOUDINI_ENGINE_MAJOR, HAPI_VERSION_HOUDINI_ENGINE_MINOR, HAPI_VERSION_HOUDINI_ENGINE_API,
+            RunningEngineMajor, RunningEngineMinor, RunningEngineApi );
+    }
+
+#endif
+}
+
+bool
+FHoudiniEngine::IsWarmingUpSessions() const
+{
+    return bSessionsWarmingUp;
+}
+
+void
+FHoudiniEngine::AddSessionsReadyDelegate( const FSimpleDelegate & SessionsReadyDelegate )
+{
+    check( IsInGameThread() );
+
+    if ( IsWarmingUpSessions() )
+        SessionsReadyDelegates.Add( SessionsReadyDelegate );
+    else
+        SessionsReadyDelegate.ExecuteIfBound();
+}
+
+void
+FHoudiniEngine::ShutdownModule()
+{
+    HOUDINI_LOG_MESSAGE( TEXT( "Shutting down the Houdini Engine module." ) );
+
+    // Stop dispatching task completions.
+    if ( CompletedTasksTickerHandle.IsValid() )
+    {
+        FTicker::GetCoreTicker().RemoveTicker( CompletedTasksTickerHandle );
+        CompletedTasksTickerHandle.Reset();
+    }
+
+    if ( SessionWatchdogTickerHandle.IsValid() )
+    {
+        FTicker::GetCoreTicker().RemoveTicker( SessionWatchdogTickerHandle );
+        SessionWatchdogTickerHandle.Reset();
+    }
+
+    TaskCompletionDelegates.Empty();
+    PendingInstantiationTasks.Empty();
+    SessionsReadyDelegates.Empty();
+
+    // Wait for session warm-up to finish, before sessions are cleaned up.
+    if ( SessionWarmUpFuture.IsValid() )
+    {
+        SessionWarmUpFuture.Wait();
+        SessionWarmUpFuture = TFuture< void >();
+    }
+
+    // We no longer need Houdini logo static mesh.
+    if ( HoudiniLogoStaticMesh.IsValid() )
+    {
+        HoudiniLogoStaticMesh->RemoveFromRoot();
+        HoudiniLogoStaticMesh = nullptr;
+    }
+
+    // We no longer need Houdini default material.
+    if ( HoudiniDefaultMaterial.IsValid() )
+    {
+        HoudiniDefaultMaterial->RemoveFromRoot();
+        HoudiniDefaultMaterial = nullptr;
+    }
+
+    // We no longer need Houdini digital asset used for loading bgeo files.
+    if ( HoudiniBgeoAsset.IsValid() )
+    {
+        HoudiniBgeoAsset->RemoveFromRoot();
+        HoudiniBgeoAsset = nullptr;
+    }
+
+#if WITH_EDITOR
+    // Unregister settings.
+    ISettingsModule * SettingsModule = FModuleManager::GetModulePtr< ISettingsModule >( "Settings" );
+    if ( SettingsModule )
+        SettingsModule->UnregisterSettings( "Project", "Plugins", "HoudiniEngine" );
+#endif
+
+    // Do scheduler and thread clean up.
+    for ( FHoudiniEngineScheduler * HoudiniEngineScheduler : HoudiniEngineSchedulers )
+    {
+        if ( HoudiniEngineScheduler )
+            HoudiniEngineScheduler->Stop();
+    }
+
+    for ( FRunnableThread * HoudiniEngineSchedulerThread : HoudiniEngineSchedulerThreads )
+    {
+        if ( HoudiniEngineSchedulerThread )
+        {
+            HoudiniEngineSchedulerThread->WaitForCompletion();
+            delete HoudiniEngineSchedulerThread;
+        }
+    }
+
+    HoudiniEngineSchedulerThreads.Empty();
+
+    for ( FHoudiniEngineScheduler * HoudiniEngineScheduler : HoudiniEngineSchedulers )
+        delete HoudiniEngineScheduler;
+
+    HoudiniEngineSchedulers.Empty();
+
+    // Perform HAPI finalization.
+    if ( FHoudiniApi::IsHAPIInitialized() )
+    {
+        for ( int32 SessionIndex = 0; SessionIndex < Sessions.Num(); ++SessionIndex )
+        {
+            if ( const HAPI_Session * SessionPtr = GetSession( SessionIndex ) )
+                FHoudiniApi::Cleanup( SessionPtr );
+        }
+    }
+
+    FHoudiniApi::FinalizeHAPI();
+
+    if ( FPlatformTLS::IsValidTlsSlot( FHoudiniEngine::SessionTlsSlot ) )
+    {
+        FPlatformTLS::FreeTlsSlot( FHoudiniEngine::SessionTlsSlot );
+        FHoudiniEngine::SessionTlsSlot = 0xFFFFFFFF;
+    }
+}
+
+void
+FHoudiniEngine::AddTask( const FHoudiniEngineTask & Task )
+{
+    // Insert empty task info first, so it cannot overwrite the scheduler's response.
+    {
+        FScopeLock ScopeLock( &CriticalSection );
+        FHoudiniEngineTaskInfo TaskInfo;
+        TaskInfos.Add( Task.HapiGUID, TaskInfo );
+    }
+
+    // Instantiations requested during the same frame, as on level load, are submitted together.
+    if ( Task.TaskType == EHoudiniEngineTaskType::AssetInstantiation && IsInGameThread() && CompletedTasksTickerHandle.IsValid() )
+    {
+        PendingInstantiationTasks.Add( Task );
+        return;
+    }
+
+    // Dispatch the task to the scheduler owning the session its asset is pinned to.
+    if ( HoudiniEngineSchedulers.Num() > 0 )
+    {
+        int32 SessionIndex = HoudiniEngineSchedulers.IsValidIndex( Task.SessionIndex ) ? Task.SessionIndex : 0;
+        if ( HoudiniEngineSchedulers[ SessionIndex ] )
+            HoudiniEngineSchedulers[ SessionIndex ]->AddTask( Task );
+    }
+}
+
+void
+FHoudiniEngine::AddTaskInfo( const FGuid HapIGUID, const FHoudiniEngineTaskInfo & TaskInfo )
+{
+    {
+        FScopeLock ScopeLock( &CriticalSection );
+        TaskInfos.Add( HapIGUID, TaskInfo );
+    }
+
+    // Queue finished tasks, so their owners get notified on the next frame.
+    switch ( TaskInfo.TaskState )
+    {
+        case EHoudiniEngineTaskState::FinishedInstantiation:
+        case EHoudiniEngineTaskState::FinishedInstantiationWithErrors:
+        case EHoudiniEngineTaskState::FinishedCooking:
+        case EHoudiniEngineTaskState::FinishedCookingWithErrors:
+        case EHoudiniEngineTaskState::Aborted:
+        {
+            CompletedTasks.Enqueue( HapIGUID );
+            break;
+        }
+
+        default:
+        {
+            break;
+        }
+    }
+}
+
+void
+FHoudiniEngine::RemoveTaskInfo( const FGuid HapIGUID )
+{
+    {
+        FScopeLock ScopeLock( &CriticalSection );
+        TaskInfos.Remove( HapIGUID );
+    }
+
+    if ( IsInGameThread() )
+        TaskCompletionDelegates.Remove( HapIGUID );
+}
+
+void
+FHoudiniEngine::SetTaskCompletionDelegate( const FGuid HapIGUID, const FSimpleDelegate & CompletionDelegate )
+{
+    check( IsInGameThread() );
+    TaskCompletionDelegates.Add( HapIGUID, CompletionDelegate );
+}
+
+void
+FHoudiniEngine::InterruptTask( const FGuid HapIGUID )
+{
+    if ( RemovePendingInstantiationTask( HapIGUID, false ) )
+        return;
+
+    // Task can only be known by one of the schedulers, the others will ignore the request.
+    for ( FHoudiniEngineScheduler * HoudiniEngineScheduler : HoudiniEngineSchedulers )
+    {
+        if ( HoudiniEngineScheduler )
+            HoudiniEngineScheduler->InterruptTask( HapIGUID, false );
+    }
+}
+
+void
+FHoudiniEngine::CancelTask( const FGuid HapIGUID )
+{
+    if ( RemovePendingInstantiationTask( HapIGUID, true ) )
+        return;
+
+    for ( FHoudiniEngineScheduler * HoudiniEngineScheduler : HoudiniEngineSchedulers )
+    {
+        if ( HoudiniEngineScheduler )
+            HoudiniEngineScheduler->InterruptTask( HapIGUID, true );
+    }
+}
+
+bool
+FHoudiniEngine::RemovePendingInstantiationTask( const FGuid & HapIGUID, bool bCancel )
+{
+    if ( !IsInGameThread() )
+        return false;
+
+    int32 PendingIdx = PendingInstantiationTasks.IndexOfByPredicate( [ &HapIGUID ]( const FHoudiniEngineTask & PendingTask )
+    {
+        return PendingTask.HapiGUID == HapIGUID;
+    } );
+
+    if ( PendingIdx == INDEX_NONE )
+        return false;
+
+    PendingInstantiationTasks.RemoveAt( PendingIdx );
+
+    if ( bCancel )
+    {
+        FHoudiniEngineTaskInfo TaskInfo(
+            HAPI_RESULT_SUCCESS, -1, EHoudiniEngineTaskType::AssetInstantiation, EHoudiniEngineTaskState::Aborted );
+        TaskInfo.StatusText = FText::FromString( TEXT( "Cancelled" ) );
+        AddTaskInfo( HapIGUID, TaskInfo );
+    }
+    else
+    {
+        DiscardTaskInfo( HapIGUID );
+    }
+
+    return true;
+}
+
+void
+FHoudiniEngine::DiscardTaskInfo( const FGuid HapIGUID )
+{
+    {
+        FScopeLock ScopeLock( &CriticalSection );
+        TaskInfos.Remove( HapIGUID );
+    }
+
+    CompletedTasks.Enqueue( HapIGUID );
+}
+
+void
+FHoudiniEngine::AddInstantiationTasks( const TArray< FHoudiniEngineTask > & Tasks )
+{
+    TMap< int32, FHoudiniEngineTask > BatchTasks;
+    for ( const FHoudiniEngineTask & Task : Tasks )
+    {
+        {
+            FScopeLock ScopeLock( &CriticalSection );
+            if ( !TaskInfos.Contains( Task.HapiGUID ) )
+                TaskInfos.Add( Task.HapiGUID, FHoudiniEngineTaskInfo() );
+        }
+
+        int32 SessionIndex = HoudiniEngineSchedulers.IsValidIndex( Task.SessionIndex ) ? Task.SessionIndex : 0;
+        FHoudiniEngineTask * BatchTask = BatchTasks.Find( SessionIndex );
+        if ( !BatchTask )
+        {
+            BatchTask = &BatchTasks.Add( SessionIndex, FHoudiniEngineTask( EHoudiniEngineTaskType::AssetBatchInstantiation, FGuid::NewGuid() ) );
+            BatchTask->SessionIndex = SessionIndex;
+            BatchTask->Priority = Task.Priority;
+        }
+        else if ( Task.Priority > BatchTask->Priority )
+        {
+            BatchTask->Priority = Task.Priority;
+        }
+
+        BatchTask->BatchTasks.Add( Task );
+    }
+
+    for ( TMap< int32, FHoudiniEngineTask >::TIterator IterBatch( BatchTasks ); IterBatch; ++IterBatch )
+    {
+        FHoudiniEngineTask & BatchTask = IterBatch.Value();
+        FHoudiniEngineTask TaskToSchedule = BatchTask.BatchTasks.Num() == 1 ? BatchTask.BatchTasks[ 0 ] : BatchTask;
+
+        if ( HoudiniEngineSchedulers.IsValidIndex( IterBatch.Key() ) && HoudiniEngineSchedulers[ IterBatch.Key() ] )
+            HoudiniEngineSchedulers[ IterBatch.Key() ]->AddTask( TaskToSchedule );
+    }
+}
+
+bool
+FHoudiniEngine::TickTasks( float DeltaTime )
+{
+    // Notify waiting users once sessions are ready.
+    if ( SessionsReadyDelegates.Num() > 0 && !IsWarmingUpSessions() )
+    {
+        TArray< FSimpleDelegate > ReadyDelegates = MoveTemp( SessionsReadyDelegates );
+        SessionsReadyDelegates.Empty();
+
+        for ( FSimpleDelegate & ReadyDelegate : ReadyDelegates )
+            ReadyDelegate.ExecuteIfBound();
+    }
+
+    // Submit instantiations requested since last frame.
+    if ( PendingInstantiationTasks.Num() > 0 )
+    {
+        TArray< FHoudiniEngineTask > InstantiationTasks = MoveTemp( PendingInstantiationTasks );
+        PendingInstantiationTasks.Empty();
+        AddInstantiationTasks( InstantiationTasks );
+    }
+
+    // Release static mesh inputs which were left unused since last frame.
+    if ( !IsWarmingUpSessions() )
+    {
+        TArray< int32 > ReleaseSessionIndices;
+        {
+            FScopeLock ScopeLock( &StaticMeshInputCriticalSection );
+            ReleaseSessionIndices = MoveTemp( StaticMeshInputReleaseSessionIndices );
+            StaticMeshInputReleaseSessionIndices.Empty();
+        }
+
+        for ( int32 SessionIndex : ReleaseSessionIndices )
+        {
+            FHoudiniEngineScopedSession ScopedSession( SessionIndex );
+            FHoudiniEngineUtils::HapiReleaseUnusedSharedStaticMeshInputs();
+        }
+    }
+
+    FGuid HapIGUID;
+    while ( CompletedTasks.Dequeue( HapIGUID ) )
+    {
+        FSimpleDelegate CompletionDelegate;
+        if ( TaskCompletionDelegates.RemoveAndCopyValue( HapIGUID, CompletionDelegate ) )
+            CompletionDelegate.ExecuteIfBound();
+    }
+
+    // Keep ticking.
+    return true;
+}
+
+bool
+FHoudiniEngine::RetrieveTaskInfo( const FGuid HapIGUID, FHoudiniEngineTaskInfo & TaskInfo )
+{
+    FScopeLock ScopeLock( &CriticalSection );
+
+    if ( TaskInfos.Contains( HapIGUID ) )
+    {
+        TaskInfo = TaskInfos[ HapIGUID ];
+        return true;
+    }
+
+    return false;
+}
+
+bool 
+FHoudiniEngine::CookNode(
+    HAPI_NodeId AssetId, FHoudiniCookParams& HoudiniCookParams,
+    bool ForceRebuildStaticMesh, bool ForceRecookAll,
+    const TMap< FHoudiniGeoPartObject, UStaticMesh * > & StaticMeshesIn,
+    TMap< FHoudiniGeoPartObject, UStaticMesh * > & StaticMeshesOut,
+    TMap< FHoudiniGeoPartObject, ALandscape * >& LandscapesIn,
+    TMap< FHoudiniGeoPartObject, ALandscape * >& LandscapesOut,
+    FTransform & ComponentTransform )
+{
+    // 
+    TMap< FHoudiniGeoPartObject, UStaticMesh * > CookResultArray;
+    bool bReturn = FHoudiniEngineUtils::CreateStaticMeshesFromHoudiniAsset(
+        AssetId, HoudiniCookParams, ForceRebuildStaticMesh, 
+        ForceRecookAll, StaticMeshesIn, CookResultArray, ComponentTransform );
+
+    if ( !bReturn )
+        return false;
+
+    // Extract the static mesh and the volumes/heightfields from the CookResultArray
+    TArray< FHoudiniGeoPartObject > FoundVolumes;
+    for ( TMap< FHoudiniGeoPartObject, UStaticMesh * >::TIterator Iter( CookResultArray ); Iter; ++Iter )
+    {
+        const FHoudiniGeoPartObject HoudiniGeoPartObject = Iter.Key();
+        UStaticMesh * StaticMesh = Iter.Value();
+
+        if ( HoudiniGeoPartObject.IsInstancer() )
+            continue;
+        else if (HoudiniGeoPartObject.IsPackedPrimitiveInstancer())
+            continue;
+        else if (HoudiniGeoPartObject.IsCurve())
+            continue;
+        else if (HoudiniGeoPartObject.IsVolume())
+        {
+            FoundVolumes.Add( HoudiniGeoPartObject );
+        }
+        else
+        {
+            StaticMeshesOut.Add( HoudiniGeoPartObject, StaticMesh );
+        }
+    }
+#if WITH_EDITOR
+    // The meshes are already created but we need to create the landscape too
+    if ( FoundVolumes.Num() > 0 )
+        bReturn = FHoudiniLandscapeUtils::CreateAllLandscapes( HoudiniCookParams, FoundVolumes, LandscapesIn, LandscapesOut, -200.0f, 200.0f );
+#endif
+
+    return bReturn;
+}
+
+void 
+FHoudiniEngine::SetEnableCookingGlobal(const bool& enableCooking)
+{
+    EnableCookingGlobal = enableCooking;
+}
+
+bool
+FHoudiniEngine::GetEnableCookingGlobal()
+{
+    return EnableCookingGlobal;
+}
+
+
+bool
+FHoudiniEngine::StartSession( HAPI_Session*& SessionPtr, int32 SessionIndex )
+{
+    // HAPI needs to be initialized
+    if ( !FHoudiniApi::IsHAPIInitialized() )
+        return false;
+
+    // Only start a new Session if we dont have a valid one
+    if ( HAPI_RESULT_SUCCESS == FHoudiniApi::IsSessionValid( SessionPtr ) )
+        return true;
+
+    const UHoudiniRuntimeSettings * HoudiniRuntimeSettings = GetDefault< UHoudiniRuntimeSettings >();
+
+    HAPI_Result SessionResult = HAPI_RESULT_FAILURE;
+
+    HAPI_ThriftServerOptions ServerOptions;
+    FMemory::Memzero< HAPI_ThriftServerOptions >( ServerOptions );
+    ServerOptions.autoClose = true;
+    ServerOptions.timeoutMs = HoudiniRuntimeSettings->AutomaticServerTimeout;
+
+    // Pooled sessions connect to their own server, using the next ports or a suffixed pipe name.
+    const int32 ServerPort = HoudiniRuntimeSettings->ServerPort + SessionIndex;
+    FString ServerPipeName = HoudiniRuntimeSettings->ServerPipeName;
+    if ( SessionIndex > 0 )
+        ServerPipeName += FString::Printf( TEXT( "_%d" ), SessionIndex );
+
+    auto UpdatePathForServer = [&]
+    {
+        // Modify our PATH so that HARC will find HARS.exe
+        const TCHAR* PathDelimiter = FPlatformMisc::GetPathVarDelimiter();
+        const int32 MaxPathVarLen = 32768;
+        TCHAR OrigPathVarMem[ MaxPathVarLen ];
+        FPlatformMisc::GetEnvironmentVariable( TEXT( "PATH" ), OrigPathVarMem, MaxPathVarLen );
+        FString OrigPathVar( OrigPathVarMem );
+
+        FString ModifiedPath =
+#if PLATFORM_MAC
+        // On Mac our binaries are split between two folders
+        LibHAPILocation + TEXT( "/../Resources/bin" ) + PathDelimiter +
+#endif
+        LibHAPILocation + PathDelimiter + OrigPathVar;
+
+        FPlatformMisc::SetEnvironmentVar( TEXT( "PATH" ), *ModifiedPath );
+    };
+
+    switch ( HoudiniRuntimeSettings->SessionType.GetValue() )
+    {
+        case EHoudiniRuntimeSettingsSessionType::HRSST_InProcess:
+        {
+            SessionResult = FHoudiniApi::CreateInProcessSession( SessionPtr );
+#if PLATFORM_WINDOWS
+            // Workaround for Houdini libtools setting stdout to binary
+            FWindowsPlatformMisc::SetUTF8Output();
+#endif
+            break;
+        }
+
+        case EHoudiniRuntimeSettingsSessionType::HRSST_Socket:
+        {
+            if ( HoudiniRuntimeSettings->bStartAutomaticServer )
+            {
+                UpdatePathForServer();
+                FHoudiniApi::StartThriftSocketServer(
+                    &ServerOptions, ServerPort, nullptr );
+            }
+
+            SessionResult = FHoudiniApi::CreateThriftSocketSession(
+                SessionPtr, TCHAR_TO_UTF8( *HoudiniRuntimeSettings->ServerHost ), ServerPort );
+        }
+        break;
+
+        case EHoudiniRuntimeSettingsSessionType::HRSST_NamedPipe:
+        {
+            if ( HoudiniRuntimeSettings->bStartAutomaticServer )
+            {
+                UpdatePathForServer();
+                FHoudiniApi::StartThriftNamedPipeServer(
+                    &ServerOptions, TCHAR_TO_UTF8( *ServerPipeName ), nullptr );
+            }
+
+            SessionResult = FHoudiniApi::CreateThriftNamedPipeSession(
+                SessionPtr, TCHAR_TO_UTF8( *ServerPipeName ) );
+        }
+        break;
+
+        default:
+            HOUDINI_LOG_ERROR( TEXT( "Unsupported Houdini Engine session type" ) );
+            break;
+    }
+
+    if ( SessionResult != HAPI_RESULT_SUCCESS || !SessionPtr )
+    {
+        if ( !HoudiniRuntimeSettings->bStartAutomaticServer )
+        {
+            HOUDINI_LOG_ERROR( TEXT( "Failed to create a Houdini Engine session.  Check that a Houdini Engine Debugger session or HARS server is running" ) );
+        }
+        else
+        {
+            HOUDINI_LOG_ERROR( TEXT( "Failed to create a Houdini Engine session" ) );
+        }
+
+        return false;
+    }
+
+    // Now, initialize HAPI with the new session
+    // We need to make sure HAPI version is correct.
+    int32 RunningEngineMajor = 0;
+    int32 RunningEngineMinor = 0;
+    int32 RunningEngineApi = 0;
+
+    // Retrieve version numbers for running Houdini Engine.
+    FHoudiniApi::GetEnvInt( HAPI_ENVINT_VERSION_HOUDINI_ENGINE_MAJOR, &RunningEngineMajor );
+    FHoudiniApi::GetEnvInt( HAPI_ENVINT_VERSION_HOUDINI_ENGINE_MINOR, &RunningEngineMinor );
+    FHoudiniApi::GetEnvInt( HAPI_ENVINT_VERSION_HOUDINI_ENGINE_API, &RunningEngineApi );
+
+    // Compare defined and running versions.
+    if ( RunningEngineMajor != HAPI_VERSION_HOUDINI_ENGINE_MAJOR
+        || RunningEngineMinor != HAPI_VERSION_HOUDINI_ENGINE_MINOR
+        || RunningEngineApi != HAPI_VERSION_HOUDINI_ENGINE_API )
     {
         bHAPIVersionMismatch = true;
 
@@ -731,14 +1169,552 @@ FHoudiniEngine::StopSession( HAPI_Session*& SessionPtr )
 bool
 FHoudiniEngine::RestartSession()
 {
-    HAPI_Session* SessionPtr = &Session;
-    if ( !StopSession( SessionPtr ) )
+    // Libraries and meshes loaded in the previous sessions are gone.
+    ClearAssetLibraryCache();
+    ClearStaticMeshInputCache();
+
+    // Restart every session of the pool, a session failing to restart does not keep the others down.
+    bool bSuccess = true;
+    for ( int32 SessionIndex = 0; SessionIndex < Sessions.Num(); ++SessionIndex )
+    {
+        // Sessions dropped from the pool have no scheduler left to process their tasks.
+        if ( !HoudiniEngineSchedulers.IsValidIndex( SessionIndex ) || !HoudiniEngineSchedulers[ SessionIndex ] )
+            continue;
+
+        // Scheduler thread must not use the session while it is being replaced.
+        FHoudiniEngineScheduler * HoudiniEngineScheduler = HoudiniEngineSchedulers[ SessionIndex ];
+        if ( !HoudiniEngineScheduler->Pause( HAPI_UNREAL_SESSION_RECOVERY_PAUSE_TIMEOUT ) )
+        {
+            HOUDINI_LOG_ERROR( TEXT( "Houdini Engine session %d is in use and cannot be restarted." ), SessionIndex );
+            bSuccess = false;
+            continue;
+        }
+
+        HAPI_Session * SessionPtr = &Sessions[ SessionIndex ];
+        if ( !StopSession( SessionPtr ) || !StartSession( SessionPtr, SessionIndex ) )
+        {
+            HOUDINI_LOG_ERROR( TEXT( "Failed to restart Houdini Engine session %d." ), SessionIndex );
+            bSuccess = false;
+        }
+
+        HoudiniEngineScheduler->Resume();
+    }
+
+    return bSuccess;
+}
+
+bool
+FHoudiniEngine::SaveHIPFiles( const FString & HIPPath, TArray< FString > & SavedHIPPaths ) const
+{
+    SavedHIPPaths.Empty();
+
+    bool bSuccess = true;
+    for ( int32 SessionIndex = 0; SessionIndex < Sessions.Num(); ++SessionIndex )
+    {
+        const HAPI_Session * SessionPtr = GetSession( SessionIndex );
+        if ( !SessionPtr || SessionPtr->type == HAPI_SESSION_MAX )
+            continue;
+
+        FString SessionHIPPath = HIPPath;
+        if ( SessionIndex > 0 )
+        {
+            SessionHIPPath = FPaths::Combine(
+                *FPaths::GetPath( HIPPath ),
+                *FString::Printf( TEXT( "%s_session%d.%s" ),
+                    *FPaths::GetBaseFilename( HIPPath ), SessionIndex, *FPaths::GetExtension( HIPPath ) ) );
+        }
+
+        std::string HIPPathConverted = TCHAR_TO_UTF8( *SessionHIPPath );
+        if ( FHoudiniApi::SaveHIPFile( SessionPtr, HIPPathConverted.c_str(), false ) != HAPI_RESULT_SUCCESS )
+        {
+            HOUDINI_LOG_ERROR( TEXT( "Failed to save scene of Houdini Engine session %d to %s." ), SessionIndex, *SessionHIPPath );
+            bSuccess = false;
+            continue;
+        }
+
+        SavedHIPPaths.Add( SessionHIPPath );
+    }
+
+    return bSuccess;
+}
+
+void
+FHoudiniEngine::PreloadAssetLibrary( UHoudiniAsset * HoudiniAsset )
+{
+    if ( !HoudiniAsset || !FHoudiniApi::IsHAPIInitialized() )
+        return;
+
+    // Which session instances of the asset are pinned to is not known yet, so the library is only warmed up
+    // on the first live session. Loading it on every session would multiply load time and memory by the pool size.
+    for ( int32 SessionIndex = 0; SessionIndex < HoudiniEngineSchedulers.Num(); ++SessionIndex )
+    {
+        if ( !HoudiniEngineSchedulers[ SessionIndex ] )
+            continue;
+
+        // Sessions are not created yet while warming up, the scheduler keeps the task until they are.
+        if ( !IsWarmingUpSessions() && Sessions[ SessionIndex ].type == HAPI_SESSION_MAX )
+            continue;
+
+        // Libraries are loaded directly by the schedulers, no task info is needed.
+        FHoudiniEngineTask Task( EHoudiniEngineTaskType::AssetLibraryLoading, FGuid::NewGuid() );
+        Task.Asset = HoudiniAsset;
+        Task.SessionIndex = SessionIndex;
+        Task.Priority = EHoudiniEngineTaskPriority::Low;
+        Task.ActorName = HoudiniAsset->GetName();
+
+        HoudiniEngineSchedulers[ SessionIndex ]->AddTask( Task );
+        break;
+    }
+}
+
+uint32
+FHoudiniEngine::ComputeAssetLibraryHash( const UHoudiniAsset * HoudiniAsset )
+{
+    uint32 Hash = HoudiniAsset->GetAssetBytesHash();
+
+    const FString & AssetFileName = HoudiniAsset->GetAssetFileName();
+    if ( AssetFileName.IsEmpty() )
+        return Hash;
+
+    // Expanded assets are loaded from their directory, any of its files may have been edited.
+    struct FAssetFileStatVisitor : public IPlatformFile::FDirectoryStatVisitor
+    {
+        FAssetFileStatVisitor() : Hash( 0 ) {}
+
+        virtual bool Visit( const TCHAR * FilenameOrDirectory, const FFileStatData & StatData ) override
+        {
+            // Files are visited in no particular order.
+            Hash ^= HashCombine( GetTypeHash( FString( FilenameOrDirectory ) ), HashStatData( StatData ) );
+            return true;
+        }
+
+        static uint32 HashStatData( const FFileStatData & StatData )
+        {
+            if ( !StatData.bIsValid )
+                return 0;
+
+            return HashCombine( GetTypeHash( StatData.ModificationTime ), GetTypeHash( StatData.FileSize ) );
+        }
+
+        uint32 Hash;
+    };
+
+    IPlatformFile & PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+    const FFileStatData FileStatData = PlatformFile.GetStatData( *AssetFileName );
+    const bool bIsExpandedLibrary =
+        FPaths::GetExtension( AssetFileName ).Compare( TEXT( "hdalibrary" ), ESearchCase::IgnoreCase ) == 0;
+    const double CurrentTime = FPlatformTime::Seconds();
+
+    {
+        FScopeLock ScopeLock( &AssetFileStatCriticalSection );
+
+        // Files of an expanded library can change without its root file changing, they are walked again
+        // after a while.
+        const FHoudiniEngineAssetFileStat * AssetFileStat = AssetFileStats.Find( AssetFileName );
+        if ( AssetFileStat && FileStatData.bIsValid && AssetFileStat->ModificationTime == FileStatData.ModificationTime &&
+            AssetFileStat->FileSize == FileStatData.FileSize &&
+            ( !bIsExpandedLibrary || CurrentTime - AssetFileStat->LastCheckTime < HAPI_UNREAL_ASSET_LIBRARY_STAT_INTERVAL ) )
+        {
+            return HashCombine( Hash, AssetFileStat->Hash );
+        }
+    }
+
+    FAssetFileStatVisitor AssetFileStatVisitor;
+    if ( bIsExpandedLibrary )
+        PlatformFile.IterateDirectoryStatRecursively( *FPaths::GetPath( AssetFileName ), AssetFileStatVisitor );
+    else
+        AssetFileStatVisitor.Hash = FAssetFileStatVisitor::HashStatData( FileStatData );
+
+    if ( FileStatData.bIsValid )
+    {
+        FScopeLock ScopeLock( &AssetFileStatCriticalSection );
+
+        FHoudiniEngineAssetFileStat & AssetFileStat = AssetFileStats.FindOrAdd( AssetFileName );
+        AssetFileStat.ModificationTime = FileStatData.ModificationTime;
+        AssetFileStat.FileSize = FileStatData.FileSize;
+        AssetFileStat.Hash = AssetFileStatVisitor.Hash;
+        AssetFileStat.LastCheckTime = CurrentTime;
+    }
+
+    return HashCombine( Hash, AssetFileStatVisitor.Hash );
+}
+
+bool
+FHoudiniEngine::GetCachedAssetLibraryId( const UHoudiniAsset * HoudiniAsset, HAPI_AssetLibraryId & AssetLibraryId )
+{
+    if ( !HoudiniAsset )
+        return false;
+
+    // Computed outside of the lock, as it reads the file system.
+    const uint32 LibraryHash = ComputeAssetLibraryHash( HoudiniAsset );
+
+    FScopeLock ScopeLock( &AssetLibraryCriticalSection );
+
+    const int32 SessionIndex = FHoudiniEngine::GetBoundSessionIndex();
+    if ( !AssetLibraries.IsValidIndex( SessionIndex ) )
+        return false;
+
+    const FHoudiniEngineAssetLibrary * AssetLibrary = AssetLibraries[ SessionIndex ].Find( HoudiniAsset->GetPathName() );
+    if ( !AssetLibrary || AssetLibrary->ContentHash != LibraryHash )
+        return false;
+
+    AssetLibraryId = AssetLibrary->AssetLibraryId;
+    return true;
+}
+
+void
+FHoudiniEngine::CacheAssetLibraryId( const UHoudiniAsset * HoudiniAsset, HAPI_AssetLibraryId AssetLibraryId )
+{
+    if ( !HoudiniAsset )
+        return;
+
+    const uint32 LibraryHash = ComputeAssetLibraryHash( HoudiniAsset );
+
+    FScopeLock ScopeLock( &AssetLibraryCriticalSection );
+
+    const int32 SessionIndex = FHoudiniEngine::GetBoundSessionIndex();
+    if ( !AssetLibraries.IsValidIndex( SessionIndex ) )
+        return;
+
+    FHoudiniEngineAssetLibrary AssetLibrary;
+    AssetLibrary.ContentHash = LibraryHash;
+    AssetLibrary.AssetLibraryId = AssetLibraryId;
+    AssetLibraries[ SessionIndex ].Add( HoudiniAsset->GetPathName(), AssetLibrary );
+}
+
+bool
+FHoudiniEngine::GetCachedAssetNames(
+    const UHoudiniAsset * HoudiniAsset, HAPI_AssetLibraryId & AssetLibraryId,
+    TArray< HAPI_StringHandle > & AssetNames )
+{
+    if ( !HoudiniAsset )
+        return false;
+
+    const uint32 LibraryHash = ComputeAssetLibraryHash( HoudiniAsset );
+
+    FScopeLock ScopeLock( &AssetLibraryCriticalSection );
+
+    const int32 SessionIndex = FHoudiniEngine::GetBoundSessionIndex();
+    if ( !AssetLibraries.IsValidIndex( SessionIndex ) )
+        return false;
+
+    const FHoudiniEngineAssetLibrary * AssetLibrary = AssetLibraries[ SessionIndex ].Find( HoudiniAsset->GetPathName() );
+    if ( !AssetLibrary || AssetLibrary->ContentHash != LibraryHash || AssetLibrary->AssetNames.Num() <= 0 )
+        return false;
+
+    AssetLibraryId = AssetLibrary->AssetLibraryId;
+    AssetNames = AssetLibrary->AssetNames;
+    return true;
+}
+
+void
+FHoudiniEngine::CacheAssetNames( const UHoudiniAsset * HoudiniAsset, const TArray< HAPI_StringHandle > & AssetNames )
+{
+    if ( !HoudiniAsset )
+        return;
+
+    const uint32 LibraryHash = ComputeAssetLibraryHash( HoudiniAsset );
+
+    FScopeLock ScopeLock( &AssetLibraryCriticalSection );
+
+    const int32 SessionIndex = FHoudiniEngine::GetBoundSessionIndex();
+    if ( !AssetLibraries.IsValidIndex( SessionIndex ) )
+        return;
+
+    FHoudiniEngineAssetLibrary * AssetLibrary = AssetLibraries[ SessionIndex ].Find( HoudiniAsset->GetPathName() );
+    if ( AssetLibrary && AssetLibrary->ContentHash == LibraryHash )
+        AssetLibrary->AssetNames = AssetNames;
+}
+
+void
+FHoudiniEngine::InvalidateAssetLibraryCache( const UHoudiniAsset * HoudiniAsset )
+{
+    if ( !HoudiniAsset )
+        return;
+
+    FScopeLock ScopeLock( &AssetLibraryCriticalSection );
+
+    const FString AssetPathName = HoudiniAsset->GetPathName();
+    for ( TMap< FString, FHoudiniEngineAssetLibrary > & SessionAssetLibraries : AssetLibraries )
+        SessionAssetLibraries.Remove( AssetPathName );
+
+    // Source file is stat-ed again on next lookup.
+    FScopeLock FileStatScopeLock( &AssetFileStatCriticalSection );
+    AssetFileStats.Remove( HoudiniAsset->GetAssetFileName() );
+}
+
+void
+FHoudiniEngine::ClearAssetLibraryCache( int32 SessionIndex )
+{
+    FScopeLock ScopeLock( &AssetLibraryCriticalSection );
+
+    if ( SessionIndex == INDEX_NONE )
+    {
+        for ( TMap< FString, FHoudiniEngineAssetLibrary > & SessionAssetLibraries : AssetLibraries )
+            SessionAssetLibraries.Empty();
+    }
+    else if ( AssetLibraries.IsValidIndex( SessionIndex ) )
+    {
+        AssetLibraries[ SessionIndex ].Empty();
+    }
+}
+
+bool
+FHoudiniEngine::GetCachedStaticMeshInput( const FString & InputKey, FHoudiniEngineStaticMeshInput & StaticMeshInput )
+{
+    FScopeLock ScopeLock( &StaticMeshInputCriticalSection );
+
+    const int32 SessionIndex = FHoudiniEngine::GetBoundSessionIndex();
+    if ( !StaticMeshInputs.IsValidIndex( SessionIndex ) )
         return false;
 
-    if ( !StartSession( SessionPtr ) )
+    const FHoudiniEngineStaticMeshInput * FoundStaticMeshInput = StaticMeshInputs[ SessionIndex ].Find( InputKey );
+    if ( !FoundStaticMeshInput )
         return false;
 
+    StaticMeshInput = *FoundStaticMeshInput;
+    return true;
+}
+
+void
+FHoudiniEngine::CacheStaticMeshInput( const FString & InputKey, const FHoudiniEngineStaticMeshInput & StaticMeshInput )
+{
+    FScopeLock ScopeLock( &StaticMeshInputCriticalSection );
+
+    const int32 SessionIndex = FHoudiniEngine::GetBoundSessionIndex();
+    if ( !StaticMeshInputs.IsValidIndex( SessionIndex ) )
+        return;
+
+    StaticMeshInputs[ SessionIndex ].Add( InputKey, StaticMeshInput );
+}
+
+void
+FHoudiniEngine::GetCachedStaticMeshInputKeys( TArray< FString > & InputKeys )
+{
+    FScopeLock ScopeLock( &StaticMeshInputCriticalSection );
+
+    InputKeys.Empty();
+    const int32 SessionIndex = FHoudiniEngine::GetBoundSessionIndex();
+    if ( StaticMeshInputs.IsValidIndex( SessionIndex ) )
+        StaticMeshInputs[ SessionIndex ].GetKeys( InputKeys );
+}
+
+void
+FHoudiniEngine::RemoveCachedStaticMeshInput( const FString & InputKey )
+{
+    FScopeLock ScopeLock( &StaticMeshInputCriticalSection );
+
+    const int32 SessionIndex = FHoudiniEngine::GetBoundSessionIndex();
+    if ( StaticMeshInputs.IsValidIndex( SessionIndex ) )
+        StaticMeshInputs[ SessionIndex ].Remove( InputKey );
+}
+
+void
+FHoudiniEngine::ClearStaticMeshInputCache( int32 SessionIndex )
+{
+    FScopeLock ScopeLock( &StaticMeshInputCriticalSection );
+
+    if ( SessionIndex == INDEX_NONE )
+    {
+        for ( TMap< FString, FHoudiniEngineStaticMeshInput > & SessionStaticMeshInputs : StaticMeshInputs )
+            SessionStaticMeshInputs.Empty();
+    }
+    else if ( StaticMeshInputs.IsValidIndex( SessionIndex ) )
+    {
+        StaticMeshInputs[ SessionIndex ].Empty();
+    }
+}
+
+void
+FHoudiniEngine::ReleaseUnusedStaticMeshInputsDeferred()
+{
+    FScopeLock ScopeLock( &StaticMeshInputCriticalSection );
+
+    const int32 SessionIndex = FHoudiniEngine::GetBoundSessionIndex();
+    if ( StaticMeshInputs.IsValidIndex( SessionIndex ) )
+        StaticMeshInputReleaseSessionIndices.AddUnique( SessionIndex );
+}
+
+bool
+FHoudiniEngine::TickSessionWatchdog( float DeltaTime )
+{
+    if ( !FHoudiniApi::IsHAPIInitialized() || IsWarmingUpSessions() )
+        return true;
+
+    TArray< int32 > LostSessionIndices;
+    for ( int32 SessionIndex = 0; SessionIndex < Sessions.Num(); ++SessionIndex )
+    {
+        // In process sessions cannot be lost without taking us down.
+        const HAPI_Session * SessionPtr = GetSession( SessionIndex );
+        if ( !SessionPtr || SessionPtr->type == HAPI_SESSION_INPROCESS )
+            continue;
+
+        if ( FHoudiniApi::IsSessionValid( SessionPtr ) != HAPI_RESULT_SUCCESS )
+            LostSessionIndices.Add( SessionIndex );
+    }
+
+    if ( LostSessionIndices.Num() > 0 )
+        RecoverSessions( LostSessionIndices );
+
+    // Keep ticking.
     return true;
 }
 
+void
+FHoudiniEngine::RecoverSessions( const TArray< int32 > & LostSessionIndices )
+{
+    // Find the assets living in lost sessions, before sessions which cannot be restarted are dropped from the pool.
+    TArray< UHoudiniAssetComponent * > LostHoudiniAssetComponents;
+    TArray< int32 > LostSessionIndicesOfComponents;
+    for ( TObjectIterator< UHoudiniAssetComponent > Itr; Itr; ++Itr )
+    {
+        UHoudiniAssetComponent * HoudiniAssetComponent = *Itr;
+        if ( !HoudiniAssetComponent || HoudiniAssetComponent->IsTemplate() || HoudiniAssetComponent->IsPendingKill() )
+            continue;
+
+        if ( !HoudiniAssetComponent->GetHoudiniAsset() )
+            continue;
+
+        const int32 SessionIndex = HoudiniAssetComponent->GetSessionIndex();
+        if ( LostSessionIndices.Contains( SessionIndex ) )
+        {
+            LostHoudiniAssetComponents.Add( HoudiniAssetComponent );
+            LostSessionIndicesOfComponents.Add( SessionIndex );
+        }
+    }
+
+    FHoudiniEngineUtils::CreateSlateNotification( TEXT( "Houdini Engine session lost, restarting it." ) );
+
+    TArray< int32 > HandledSessionIndices;
+    int32 RestartedSessionCount = 0;
+    for ( int32 SessionIndex : LostSessionIndices )
+    {
+        // The scheduler thread may still be using the session, it has to be parked between tasks before the
+        // session is replaced. A busy session is recovered on a later watchdog tick.
+        FHoudiniEngineScheduler * HoudiniEngineScheduler =
+            HoudiniEngineSchedulers.IsValidIndex( SessionIndex ) ? HoudiniEngineSchedulers[ SessionIndex ] : nullptr;
+        if ( HoudiniEngineScheduler && !HoudiniEngineScheduler->Pause( HAPI_UNREAL_SESSION_RECOVERY_PAUSE_TIMEOUT ) )
+        {
+            HOUDINI_LOG_WARNING( TEXT( "Houdini Engine session %d is no longer valid, but is still in use." ), SessionIndex );
+            continue;
+        }
+
+        HandledSessionIndices.Add( SessionIndex );
+        HOUDINI_LOG_WARNING( TEXT( "Houdini Engine session %d is no longer valid, restarting it." ), SessionIndex );
+
+        // Libraries and meshes loaded in the lost session are gone.
+        ClearAssetLibraryCache( SessionIndex );
+        ClearStaticMeshInputCache( SessionIndex );
+
+        HAPI_Session * SessionPtr = &Sessions[ SessionIndex ];
+        StopSession( SessionPtr );
+
+        if ( StartSession( SessionPtr, SessionIndex ) )
+        {
+            RestartedSessionCount++;
+
+            if ( HoudiniEngineScheduler )
+                HoudiniEngineScheduler->Resume();
+        }
+        else
+        {
+            // Assets will be pinned to the remaining sessions of the pool.
+            HOUDINI_LOG_ERROR( TEXT( "Failed to restart Houdini Engine session %d." ), SessionIndex );
+            Sessions[ SessionIndex ].type = HAPI_SESSION_MAX;
+            Sessions[ SessionIndex ].id = -1;
+
+            DropSessionScheduler( SessionIndex );
+        }
+    }
+
+    if ( HandledSessionIndices.Num() == 0 )
+        return;
+
+    // Replay instantiation and parameter state of the lost assets. Instantiations requested during this
+    // frame are batched per session, and downstream assets wait for their upstream assets to instantiate.
+    for ( int32 Idx = 0; Idx < LostHoudiniAssetComponents.Num(); ++Idx )
+    {
+        if ( HandledSessionIndices.Contains( LostSessionIndicesOfComponents[ Idx ] ) )
+            LostHoudiniAssetComponents[ Idx ]->NotifySessionRestarted();
+    }
+
+    FHoudiniEngineUtils::CreateSlateNotification( RestartedSessionCount == HandledSessionIndices.Num() ?
+        TEXT( "Houdini Engine session successfully restarted." ) : TEXT( "Failed to restart a Houdini Engine session." ) );
+}
+
+void
+FHoudiniEngine::DropSessionScheduler( int32 SessionIndex )
+{
+    if ( !HoudiniEngineSchedulers.IsValidIndex( SessionIndex ) || !HoudiniEngineSchedulers[ SessionIndex ] )
+        return;
+
+    FHoudiniEngineScheduler * HoudiniEngineScheduler = HoudiniEngineSchedulers[ SessionIndex ];
+    HoudiniEngineSchedulers[ SessionIndex ] = nullptr;
+    HoudiniEngineScheduler->Stop();
+
+    if ( HoudiniEngineSchedulerThreads.IsValidIndex( SessionIndex ) && HoudiniEngineSchedulerThreads[ SessionIndex ] )
+    {
+        HoudiniEngineSchedulerThreads[ SessionIndex ]->WaitForCompletion();
+        delete HoudiniEngineSchedulerThreads[ SessionIndex ];
+        HoudiniEngineSchedulerThreads[ SessionIndex ] = nullptr;
+    }
+
+    // Scheduler thread has exited, its queue can be safely emptied.
+    TArray< FHoudiniEngineTask > OrphanedTasks;
+    HoudiniEngineScheduler->DrainTasks( OrphanedTasks );
+    delete HoudiniEngineScheduler;
+
+    // Same lookup as GetSessionIndexForGuid, assets pinned to the dropped session move to the next live one.
+    int32 TargetSessionIndex = INDEX_NONE;
+    for ( int32 Offset = 1; Offset < Sessions.Num(); ++Offset )
+    {
+        int32 CandidateIndex = ( SessionIndex + Offset ) % Sessions.Num();
+        if ( Sessions[ CandidateIndex ].type != HAPI_SESSION_MAX &&
+            HoudiniEngineSchedulers.IsValidIndex( CandidateIndex ) && HoudiniEngineSchedulers[ CandidateIndex ] )
+        {
+            TargetSessionIndex = CandidateIndex;
+            break;
+        }
+    }
+
+    for ( FHoudiniEngineTask & Task : OrphanedTasks )
+    {
+        // Cooks and deletions refer to nodes which were lost with the session, their assets are reinstantiated.
+        const bool bCanBeMoved = TargetSessionIndex != INDEX_NONE &&
+            ( Task.TaskType == EHoudiniEngineTaskType::AssetInstantiation ||
+              Task.TaskType == EHoudiniEngineTaskType::AssetBatchInstantiation ||
+              Task.TaskType == EHoudiniEngineTaskType::AssetLibraryLoading );
+
+        if ( !bCanBeMoved )
+        {
+            for ( const FHoudiniEngineTask & BatchedTask : Task.BatchTasks )
+                DiscardTaskInfo( BatchedTask.HapiGUID );
+
+            DiscardTaskInfo( Task.HapiGUID );
+            continue;
+        }
+
+        Task.SessionIndex = TargetSessionIndex;
+        for ( FHoudiniEngineTask & BatchedTask : Task.BatchTasks )
+            BatchedTask.SessionIndex = TargetSessionIndex;
+
+        HoudiniEngineSchedulers[ TargetSessionIndex ]->AddTask( Task );
+    }
+
+    HOUDINI_LOG_MESSAGE(
+        TEXT( "Stopped scheduler of Houdini Engine session %d, %d queued tasks were handed over to session %d." ),
+        SessionIndex, OrphanedTasks.Num(), TargetSessionIndex );
+}
+
+FHoudiniEngineScopedSession::FHoudiniEngineScopedSession( int32 SessionIndex )
+    : PreviousSessionIndex( FHoudiniEngine::GetBoundSessionIndex() )
+{
+    FHoudiniEngine::SetBoundSessionIndex( SessionIndex );
+}
+
+FHoudiniEngineScopedSession::~FHoudiniEngineScopedSession()
+{
+    FHoudiniEngine::SetBoundSessionIndex( PreviousSessionIndex );
+}
+
 #undef LOCTEXT_NAMESPACE
\ No newline at end of file
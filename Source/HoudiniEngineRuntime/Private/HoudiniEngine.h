@@ -25,12 +25,74 @@
 
 #include "IHoudiniEngine.h"
 #include "HoudiniEngineTaskInfo.h"
+#include "Containers/Queue.h"
+#include "Containers/Ticker.h"
+#include "Async/Future.h"
 
 
 class UStaticMesh;
+class UHoudiniAsset;
 class FRunnableThread;
 class FHoudiniEngineScheduler;
 
+/** Asset library loaded in a session, along with the assets it contains. **/
+struct FHoudiniEngineAssetLibrary
+{
+    FHoudiniEngineAssetLibrary()
+        : ContentHash( 0 )
+        , AssetLibraryId( -1 )
+    {}
+
+    /** Hash of the Houdini asset data and of the state of the source file the library was loaded from. **/
+    uint32 ContentHash;
+
+    /** Id of the loaded library. **/
+    HAPI_AssetLibraryId AssetLibraryId;
+
+    /** Names of the assets within the library, empty until they have been retrieved. **/
+    TArray< HAPI_StringHandle > AssetNames;
+};
+
+/** State of the source file of an asset library, so that it is only hashed again once it changed. **/
+struct FHoudiniEngineAssetFileStat
+{
+    FHoudiniEngineAssetFileStat()
+        : FileSize( -1 )
+        , Hash( 0 )
+        , LastCheckTime( 0.0 )
+    {}
+
+    /** Modification time of the source file. **/
+    FDateTime ModificationTime;
+
+    /** Size of the source file. **/
+    int64 FileSize;
+
+    /** Hash of the state of the source file, or of all files of an expanded library. **/
+    uint32 Hash;
+
+    /** Time the files of an expanded library have last been walked. **/
+    double LastCheckTime;
+};
+
+/** Static mesh uploaded to a session, shared by the inputs exporting the same mesh with the same options. **/
+struct FHoudiniEngineStaticMeshInput
+{
+    FHoudiniEngineStaticMeshInput()
+        : ContentHash( 0 )
+        , NodeId( -1 )
+    {}
+
+    /** Hash of the static mesh data and export options the node was uploaded from. **/
+    uint64 ContentHash;
+
+    /** Id of the committed node holding the uploaded mesh. **/
+    HAPI_NodeId NodeId;
+
+    /** Object merge nodes of the inputs referencing the uploaded mesh. **/
+    TArray< HAPI_NodeId > ObjectMergeNodeIds;
+};
+
 class HOUDINIENGINERUNTIME_API FHoudiniEngine : public IHoudiniEngine
 {
     public:
@@ -76,10 +138,121 @@ class HOUDINIENGINERUNTIME_API FHoudiniEngine : public IHoudiniEngine
         void SetEnableCookingGlobal(const bool& enableCooking);
         bool GetEnableCookingGlobal();
 
-        bool StartSession( HAPI_Session*& SessionPtr );
+        bool StartSession( HAPI_Session*& SessionPtr, int32 SessionIndex = 0 );
         bool StopSession( HAPI_Session*& SessionPtr );
         bool RestartSession();
 
+        /** Save the scene of every session of the pool. The first session is saved to given path, the others **/
+        /** next to it with their index appended. Returns the paths of the saved files.                        **/
+        bool SaveHIPFiles( const FString & HIPPath, TArray< FString > & SavedHIPPaths ) const;
+
+        /** Return the session of the pool with the given index, nullptr if it has not been created. **/
+        const HAPI_Session * GetSession( int32 SessionIndex ) const;
+
+        /** Return number of sessions in the pool. **/
+        int32 GetSessionCount() const;
+
+        /** Return index of the pooled session an asset with given GUID is pinned to. **/
+        int32 GetSessionIndexForGuid( const FGuid & Guid ) const;
+
+        /** Return index of the session bound to the calling thread, 0 if none has been bound. **/
+        static int32 GetBoundSessionIndex();
+
+        /** Bind the calling thread to the session with given index, used by FHoudiniEngineScopedSession. **/
+        static void SetBoundSessionIndex( int32 SessionIndex );
+
+        /** Register delegate executed on the game thread on the frame after the task with given GUID finishes. **/
+        void SetTaskCompletionDelegate( const FGuid HapIGUID, const FSimpleDelegate & CompletionDelegate );
+
+        /** Request interruption of a queued or running task. Once interrupted, its task info is discarded. **/
+        void InterruptTask( const FGuid HapIGUID );
+
+        /** Cancel a queued task or a running cook. Once cancelled, the task is reported as aborted. **/
+        void CancelTask( const FGuid HapIGUID );
+
+        /** Remove info of a task which will not complete and notify its owner on the next frame. **/
+        void DiscardTaskInfo( const FGuid HapIGUID );
+
+        /** Submit several instantiation tasks, tasks pinned to the same session are instantiated as one batch. **/
+        void AddInstantiationTasks( const TArray< FHoudiniEngineTask > & Tasks );
+
+        /** Return true while the sessions are being created and initialized in the background. **/
+        bool IsWarmingUpSessions() const;
+
+        /** Register delegate executed on the game thread once the sessions are ready, executed right away if **/
+        /** they already are.                                                                                  **/
+        void AddSessionsReadyDelegate( const FSimpleDelegate & SessionsReadyDelegate );
+
+        /** Queue loading of the asset library of given asset on the first live session, at low priority. **/
+        void PreloadAssetLibrary( UHoudiniAsset * HoudiniAsset );
+
+        /** Look up the library loaded for given asset in the session bound to the calling thread. Libraries **/
+        /** loaded from different asset data are ignored.                                                       **/
+        bool GetCachedAssetLibraryId( const UHoudiniAsset * HoudiniAsset, HAPI_AssetLibraryId & AssetLibraryId );
+
+        /** Remember the library loaded for given asset in the session bound to the calling thread. **/
+        void CacheAssetLibraryId( const UHoudiniAsset * HoudiniAsset, HAPI_AssetLibraryId AssetLibraryId );
+
+        /** Look up the library and asset names retrieved for given asset in the session bound to the calling thread. **/
+        bool GetCachedAssetNames(
+            const UHoudiniAsset * HoudiniAsset, HAPI_AssetLibraryId & AssetLibraryId,
+            TArray< HAPI_StringHandle > & AssetNames );
+
+        /** Remember asset names retrieved from the cached library of given asset. **/
+        void CacheAssetNames( const UHoudiniAsset * HoudiniAsset, const TArray< HAPI_StringHandle > & AssetNames );
+
+        /** Forget libraries loaded for given asset in every session, used when the asset is reimported. **/
+        void InvalidateAssetLibraryCache( const UHoudiniAsset * HoudiniAsset );
+
+        /** Forget libraries loaded in the session with given index, or in all sessions if INDEX_NONE. **/
+        void ClearAssetLibraryCache( int32 SessionIndex = INDEX_NONE );
+
+        /** Look up the static mesh input uploaded with given key in the session bound to the calling thread. **/
+        bool GetCachedStaticMeshInput( const FString & InputKey, FHoudiniEngineStaticMeshInput & StaticMeshInput );
+
+        /** Remember the static mesh input uploaded with given key in the session bound to the calling thread. **/
+        void CacheStaticMeshInput( const FString & InputKey, const FHoudiniEngineStaticMeshInput & StaticMeshInput );
+
+        /** Return the keys of the static mesh inputs uploaded in the session bound to the calling thread. **/
+        void GetCachedStaticMeshInputKeys( TArray< FString > & InputKeys );
+
+        /** Forget the static mesh input uploaded with given key in the session bound to the calling thread. **/
+        void RemoveCachedStaticMeshInput( const FString & InputKey );
+
+        /** Forget static mesh inputs uploaded in the session with given index, or in all sessions if INDEX_NONE. **/
+        void ClearStaticMeshInputCache( int32 SessionIndex = INDEX_NONE );
+
+        /** Destroy the static mesh inputs no longer merged by any input of the session bound to the calling   **/
+        /** thread on the next tick, so inputs which are being rebuilt can merge their uploads again meanwhile. **/
+        void ReleaseUnusedStaticMeshInputsDeferred();
+
+        /** Restart the sessions with given indices, which are no longer valid, and reinstantiate the assets **/
+        /** which were living in them.                                                                         **/
+        void RecoverSessions( const TArray< int32 > & LostSessionIndices );
+
+    protected:
+
+        /** Ticker callback, submits batched instantiations and dispatches completion delegates of **/
+        /** finished tasks on the game thread.                                                     **/
+        bool TickTasks( float DeltaTime );
+
+        /** Create and initialize the sessions of the pool, may run on the warm-up thread. **/
+        void WarmUpSessions();
+
+        /** Remove an instantiation task which has not been submitted to the schedulers yet. **/
+        bool RemovePendingInstantiationTask( const FGuid & HapIGUID, bool bCancel );
+
+        /** Ticker callback, checks that out of process sessions are still valid and recovers lost ones. **/
+        bool TickSessionWatchdog( float DeltaTime );
+
+        /** Stop the scheduler of a session which could not be restarted, its queued instantiations are moved **/
+        /** to the next live session of the pool, where the assets pinned to the dropped session end up.       **/
+        void DropSessionScheduler( int32 SessionIndex );
+
+        /** Hash identifying the content a library of given asset is loaded from, the source file is usually **/
+        /** loaded instead of the imported data, so its modification time and size are included.              **/
+        uint32 ComputeAssetLibraryHash( const UHoudiniAsset * HoudiniAsset );
+
     public:
 
         /** App identifier string. **/
@@ -93,11 +266,17 @@ class HOUDINIENGINERUNTIME_API FHoudiniEngine : public IHoudiniEngine
         /** Return true if singleton instance has been created. **/
         static bool IsInitialized();
 
+        /** Return true if singleton instance has been created, even if sessions are not ready yet. **/
+        static bool IsLoaded();
+
     private:
 
         /** Singleton instance of Houdini Engine. **/
         static FHoudiniEngine * HoudiniEngineInstance;
 
+        /** TLS slot storing the session index bound to a thread. **/
+        static uint32 SessionTlsSlot;
+
     private:
 
         /** Static mesh used for Houdini logo rendering. **/
@@ -122,11 +301,26 @@ class HOUDINIENGINERUNTIME_API FHoudiniEngine : public IHoudiniEngine
         /** Map of task statuses. **/
         TMap< FGuid, FHoudiniEngineTaskInfo > TaskInfos;
 
-        /** Thread used to execute the scheduler. **/
-        FRunnableThread * HoudiniEngineSchedulerThread;
+        /** GUIDs of finished tasks, filled by schedulers and drained on the game thread. **/
+        TQueue< FGuid, EQueueMode::Mpsc > CompletedTasks;
+
+        /** Delegates to execute when tasks finish, only accessed on the game thread. **/
+        TMap< FGuid, FSimpleDelegate > TaskCompletionDelegates;
+
+        /** Instantiation tasks added on the game thread during this frame, submitted as batches. **/
+        TArray< FHoudiniEngineTask > PendingInstantiationTasks;
 
-        /** Scheduler used to schedule HAPI instantiation and cook tasks. **/
-        FHoudiniEngineScheduler * HoudiniEngineScheduler;
+        /** Handle of the ticker used to drain finished tasks. **/
+        FDelegateHandle CompletedTasksTickerHandle;
+
+        /** Handle of the ticker used to check session validity. **/
+        FDelegateHandle SessionWatchdogTickerHandle;
+
+        /** Threads used to execute the schedulers, one per session. **/
+        TArray< FRunnableThread * > HoudiniEngineSchedulerThreads;
+
+        /** Schedulers used to schedule HAPI instantiation and cook tasks, one per session. **/
+        TArray< FHoudiniEngineScheduler * > HoudiniEngineSchedulers;
 
         /** Location of libHAPI binary. **/
         FString LibHAPILocation;
@@ -137,9 +331,56 @@ class HOUDINIENGINERUNTIME_API FHoudiniEngine : public IHoudiniEngine
         /** Is set to true when mismatch between defined and running HAPI versions is detected. **/
         bool bHAPIVersionMismatch;
 
-        /** The Houdini Engine session. **/
-        HAPI_Session Session;
+        /** The Houdini Engine sessions, first one is the main session. **/
+        TArray< HAPI_Session > Sessions;
 
         /** Global cooking flag, used to pause HEngine while using the editor **/
         bool EnableCookingGlobal;
+
+        /** Is set to true when sessions are created on the warm-up thread. **/
+        bool bWarmUpSessionsInBackground;
+
+        /** Is set while the sessions are being warmed up. **/
+        FThreadSafeBool bSessionsWarmingUp;
+
+        /** Id of the thread warming up the sessions, the only one allowed to use them meanwhile. **/
+        uint32 SessionWarmUpThreadId;
+
+        /** Result of the background session warm-up. **/
+        TFuture< void > SessionWarmUpFuture;
+
+        /** Delegates to execute on the game thread once sessions are ready. **/
+        TArray< FSimpleDelegate > SessionsReadyDelegates;
+
+        /** Synchronization primitive for the asset library cache. **/
+        FCriticalSection AssetLibraryCriticalSection;
+
+        /** Synchronization primitive for the asset file state cache. **/
+        FCriticalSection AssetFileStatCriticalSection;
+
+        /** State of the source files of asset libraries, keyed by file name. **/
+        TMap< FString, FHoudiniEngineAssetFileStat > AssetFileStats;
+
+        /** Libraries loaded in each session of the pool, keyed by asset path. **/
+        TArray< TMap< FString, FHoudiniEngineAssetLibrary > > AssetLibraries;
+
+        /** Synchronization primitive for the static mesh input cache. **/
+        FCriticalSection StaticMeshInputCriticalSection;
+
+        /** Static mesh inputs uploaded in each session of the pool, keyed by mesh path and export options. **/
+        TArray< TMap< FString, FHoudiniEngineStaticMeshInput > > StaticMeshInputs;
+
+        /** Sessions whose unused static mesh inputs are released on the next tick. **/
+        TArray< int32 > StaticMeshInputReleaseSessionIndices;
+};
+
+/** Binds the calling thread to a session of the pool for the lifetime of this object. All HAPI calls made **/
+/** through FHoudiniEngine::GetSession() within the scope will target that session.                         **/
+struct HOUDINIENGINERUNTIME_API FHoudiniEngineScopedSession
+{
+    FHoudiniEngineScopedSession( int32 SessionIndex );
+    ~FHoudiniEngineScopedSession();
+
+    /** Session index that was bound before entering the scope. **/
+    int32 PreviousSessionIndex;
 };
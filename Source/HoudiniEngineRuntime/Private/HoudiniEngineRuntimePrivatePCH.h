@@ -224,6 +224,7 @@
 #define HAPI_UNREAL_ATTRIB_INSTANCE_POSITION            HAPI_ATTRIB_POSITION
 #define HAPI_UNREAL_ATTRIB_POSITION                     HAPI_ATTRIB_POSITION
 #define HAPI_UNREAL_ATTRIB_ROTATION                     "rot"
+#define HAPI_UNREAL_ATTRIB_ORIENT                       "orient"
 #define HAPI_UNREAL_ATTRIB_SCALE                        "scale"
 #define HAPI_UNREAL_ATTRIB_UNIFORM_SCALE                "pscale"
 #define HAPI_UNREAL_ATTRIB_COLOR                        HAPI_ATTRIB_COLOR
@@ -396,6 +397,23 @@
 
 #define HAPI_UNREAL_SESSION_SERVER_AUTOSTART                true
 #define HAPI_UNREAL_SESSION_SERVER_TIMEOUT                  3000.0f
+#define HAPI_UNREAL_SESSION_POOL_SIZE_MAX                   16
+#define HAPI_UNREAL_SESSION_WATCHDOG_INTERVAL               5.0f
+#define HAPI_UNREAL_SESSION_RECOVERY_PAUSE_TIMEOUT          2.0f
+
+/** Minimum delay between two walks of the files of an expanded asset library, in seconds. **/
+#define HAPI_UNREAL_ASSET_LIBRARY_STAT_INTERVAL             1.0
+
+/** Number of elements converted and sent per call when uploading input meshes, whole triangles only. **/
+#define HAPI_UNREAL_INPUT_UPLOAD_CHUNK_SIZE                 ( 3 * 65536 )
+
+/** Cook status polling defaults, in milliseconds. **/
+#define HAPI_UNREAL_COOK_STATUS_POLL_MIN_INTERVAL           1.0f
+#define HAPI_UNREAL_COOK_STATUS_POLL_MAX_INTERVAL           50.0f
+#define HAPI_UNREAL_COOK_STATUS_POLL_BACKOFF_FACTOR         2.0f
+
+/** Number of times a cook can be pre-empted, it then runs to completion. **/
+#define HAPI_UNREAL_COOK_MAX_PREEMPTIONS                    2
 
 /** Default position and transformation scaling options. **/
 #define HAPI_UNREAL_SCALE_FACTOR_POSITION                   100.0f
@@ -36,39 +36,70 @@
 #include "HoudiniEngine.h"
 #include "HoudiniAsset.h"
 #include "HoudiniEngineString.h"
-#include "ScopeLock.h"
+#include "HoudiniRuntimeSettings.h"
 
-const uint32
-FHoudiniEngineScheduler::InitialTaskSize = 256u;
+DECLARE_DWORD_ACCUMULATOR_STAT( TEXT( "Houdini: Instantiation Status Polls" ), STAT_InstantiationStatusPolls, STATGROUP_HoudiniEngine );
+DECLARE_DWORD_ACCUMULATOR_STAT( TEXT( "Houdini: Cook Status Polls" ), STAT_CookStatusPolls, STATGROUP_HoudiniEngine );
 
-FHoudiniEngineScheduler::FHoudiniEngineScheduler()
-    : Tasks( nullptr )
-    , PositionWrite( 0u )
-    , PositionRead( 0u )
-    , bStopping( false )
+FHoudiniEngineStatusPollBackoff::FHoudiniEngineStatusPollBackoff()
+    : Interval( 0.0f )
+    , MinInterval( HAPI_UNREAL_COOK_STATUS_POLL_MIN_INTERVAL / 1000.0f )
+    , MaxInterval( HAPI_UNREAL_COOK_STATUS_POLL_MAX_INTERVAL / 1000.0f )
+    , BackoffFactor( HAPI_UNREAL_COOK_STATUS_POLL_BACKOFF_FACTOR )
 {
-    //  Make sure size is power of two.
-    TaskCount = FPlatformMath::RoundUpToPowerOfTwo( FHoudiniEngineScheduler::InitialTaskSize );
-
-    if ( TaskCount )
+    const UHoudiniRuntimeSettings * HoudiniRuntimeSettings = GetDefault< UHoudiniRuntimeSettings >();
+    if ( HoudiniRuntimeSettings )
     {
-        // Allocate buffer to store all tasks.
-        Tasks = static_cast< FHoudiniEngineTask * >( FMemory::Malloc( TaskCount * sizeof( FHoudiniEngineTask ) ) );
-
-        if ( Tasks )
-        {
-            // Zero memory.
-            FMemory::Memset( Tasks, 0x0, TaskCount * sizeof( FHoudiniEngineTask ) );
-        }
+        MinInterval = FMath::Max( HoudiniRuntimeSettings->CookStatusPollMinInterval, 0.0f ) / 1000.0f;
+        MaxInterval = FMath::Max( HoudiniRuntimeSettings->CookStatusPollMaxInterval / 1000.0f, MinInterval );
+        BackoffFactor = FMath::Max( HoudiniRuntimeSettings->CookStatusPollBackoffFactor, 1.0f );
     }
 }
 
+void
+FHoudiniEngineStatusPollBackoff::Wait()
+{
+    FPlatformProcess::Sleep( Interval );
+
+    if ( Interval <= 0.0f )
+        Interval = MinInterval;
+    else
+        Interval = FMath::Min( Interval * BackoffFactor, MaxInterval );
+}
+
+FHoudiniEngineScheduler::FHoudiniEngineScheduler( int32 InSessionIndex )
+    : TaskEvent( nullptr )
+    , SessionIndex( InSessionIndex )
+    , bStopping( false )
+    , bPauseRequested( false )
+    , bPaused( false )
+    , PausedEvent( nullptr )
+    , ResumeEvent( nullptr )
+{
+    // Auto reset event, scheduler thread sleeps on it while the queue is empty.
+    TaskEvent = FPlatformProcess::GetSynchEventFromPool( false );
+    PausedEvent = FPlatformProcess::GetSynchEventFromPool( false );
+    ResumeEvent = FPlatformProcess::GetSynchEventFromPool( false );
+}
+
 FHoudiniEngineScheduler::~FHoudiniEngineScheduler()
 {
-    if ( TaskCount )
+    if ( TaskEvent )
+    {
+        FPlatformProcess::ReturnSynchEventToPool( TaskEvent );
+        TaskEvent = nullptr;
+    }
+
+    if ( PausedEvent )
+    {
+        FPlatformProcess::ReturnSynchEventToPool( PausedEvent );
+        PausedEvent = nullptr;
+    }
+
+    if ( ResumeEvent )
     {
-        FMemory::Free( Tasks );
-        Tasks = nullptr;
+        FPlatformProcess::ReturnSynchEventToPool( ResumeEvent );
+        ResumeEvent = nullptr;
     }
 }
 
@@ -95,9 +126,11 @@ FHoudiniEngineScheduler::TaskDescription(
     }
 }
 
-void
-FHoudiniEngineScheduler::TaskInstantiateAsset( const FHoudiniEngineTask & Task )
+bool
+FHoudiniEngineScheduler::CreateAssetNode( const FHoudiniEngineTask & Task, HAPI_NodeId & AssetId )
 {
+    AssetId = -1;
+
     FString AssetN;
     FHoudiniEngineString( Task.AssetHapiName ).ToFString( AssetN );
 
@@ -117,7 +150,7 @@ FHoudiniEngineScheduler::TaskInstantiateAsset( const FHoudiniEngineTask & Task )
             EHoudiniEngineTaskState::FinishedInstantiationWithErrors,
             -1, Task, TEXT( "HAPI is not initialized." ) );
 
-        return;
+        return false;
     }
 
     if ( !Task.Asset.IsValid() )
@@ -128,7 +161,7 @@ FHoudiniEngineScheduler::TaskInstantiateAsset( const FHoudiniEngineTask & Task )
             EHoudiniEngineTaskState::FinishedInstantiationWithErrors,
             -1, Task, TEXT( "Asset is no longer valid." ) );
 
-        return;
+        return false;
     }
 
     if ( Task.AssetHapiName < 0 )
@@ -139,106 +172,273 @@ FHoudiniEngineScheduler::TaskInstantiateAsset( const FHoudiniEngineTask & Task )
             EHoudiniEngineTaskState::FinishedInstantiationWithErrors,
             -1, Task, TEXT( "Asset name is invalid." ) );
 
-        return;
+        return false;
     }
 
-    HAPI_Result Result = HAPI_RESULT_SUCCESS;
-    UHoudiniAsset* HoudiniAsset = Task.Asset.Get();
-    int32 AssetCount = 0;
-    HAPI_NodeId AssetId = -1;
     std::string AssetNameString;
-    double LastUpdateTime;
-
     FHoudiniEngineString HoudiniEngineString( Task.AssetHapiName );
-    if ( HoudiniEngineString.ToStdString( AssetNameString ) )
+    if ( !HoudiniEngineString.ToStdString( AssetNameString ) )
+    {
+        AddResponseMessageTaskInfo(
+            HAPI_RESULT_FAILURE, EHoudiniEngineTaskType::AssetInstantiation,
+            EHoudiniEngineTaskState::FinishedInstantiationWithErrors,
+            -1, Task, TEXT( "Error retrieving asset name." ) );
+
+        return false;
+    }
+
+    // We instantiate without cooking.
+    HAPI_Result Result = FHoudiniApi::CreateNode(
+        FHoudiniEngine::Get().GetSession(), -1, &AssetNameString[ 0 ], nullptr, false, &AssetId );
+    if ( Result != HAPI_RESULT_SUCCESS )
     {
-        // Translate asset name into Unreal string.
-        FString AssetName = ANSI_TO_TCHAR( AssetNameString.c_str() );
+        AssetId = -1;
+        AddResponseMessageTaskInfo(
+            Result, EHoudiniEngineTaskType::AssetInstantiation,
+            EHoudiniEngineTaskState::FinishedInstantiationWithErrors,
+            -1, Task, TEXT( "Error instantiating asset." ) );
 
-        // Initialize last update time.
-        LastUpdateTime = FPlatformTime::Seconds();
+        return false;
+    }
+
+    // Add processing notification.
+    FHoudiniEngineTaskInfo TaskInfo(
+        HAPI_RESULT_SUCCESS, -1, EHoudiniEngineTaskType::AssetInstantiation,
+        EHoudiniEngineTaskState::Processing );
+
+    TaskInfo.bLoadedComponent = Task.bLoadedComponent;
+    TaskDescription( TaskInfo, Task.ActorName, TEXT( "Started Instantiation" ) );
+    FHoudiniEngine::Get().AddTaskInfo( Task.HapiGUID, TaskInfo );
+
+    return true;
+}
+
+int32
+FHoudiniEngineScheduler::WaitForInstantiation(
+    const TArray< FHoudiniEngineTask > & InstantiationTasks, const TArray< HAPI_NodeId > & AssetIds,
+    bool & bSessionLost )
+{
+    HAPI_Result Result = HAPI_RESULT_SUCCESS;
+    bSessionLost = false;
+
+    // Initialize last update time.
+    double LastUpdateTime = FPlatformTime::Seconds();
+    FHoudiniEngineStatusPollBackoff PollBackoff;
+
+    // We need to spin until instantiation is finished.
+    while ( true )
+    {
+        int Status = HAPI_STATE_STARTING_COOK;
+        HOUDINI_CHECK_ERROR( &Result, FHoudiniApi::GetStatus(
+            FHoudiniEngine::Get().GetSession(), HAPI_STATUS_COOK_STATE, &Status ) );
+        INC_DWORD_STAT( STAT_InstantiationStatusPolls );
 
-        // We instantiate without cooking.
-        Result = FHoudiniApi::CreateNode(
-            FHoudiniEngine::Get().GetSession(), -1, &AssetNameString[ 0 ], nullptr, false, &AssetId );
         if ( Result != HAPI_RESULT_SUCCESS )
         {
-            AddResponseMessageTaskInfo(
-                Result, EHoudiniEngineTaskType::AssetInstantiation,
-                EHoudiniEngineTaskState::FinishedInstantiationWithErrors,
-                -1, Task, TEXT( "Error instantiating asset." ) );
-
-            return;
+            // Cook state cannot be retrieved anymore, session is most likely gone.
+            bSessionLost = true;
+            return HAPI_STATE_READY_WITH_FATAL_ERRORS;
         }
 
-        // Add processing notification.
-        FHoudiniEngineTaskInfo TaskInfo(
-            HAPI_RESULT_SUCCESS, -1, EHoudiniEngineTaskType::AssetInstantiation,
-            EHoudiniEngineTaskState::Processing );
-
-        TaskInfo.bLoadedComponent = Task.bLoadedComponent;
-        TaskDescription( TaskInfo, Task.ActorName, TEXT( "Started Instantiation" ) );
-        FHoudiniEngine::Get().AddTaskInfo( Task.HapiGUID, TaskInfo );
+        if ( Status <= HAPI_STATE_MAX_READY_STATE )
+            return Status;
 
-        // We need to spin until instantiation is finished.
-        while( true )
+        static const double NotificationUpdateFrequency = 0.5;
+        if ( ( FPlatformTime::Seconds() - LastUpdateTime ) >= NotificationUpdateFrequency )
         {
-            int Status = HAPI_STATE_STARTING_COOK;
-            HOUDINI_CHECK_ERROR( &Result, FHoudiniApi::GetStatus(
-                FHoudiniEngine::Get().GetSession(), HAPI_STATUS_COOK_STATE, &Status ) );
+            // Reset update time.
+            LastUpdateTime = FPlatformTime::Seconds();
 
-            if ( Status == HAPI_STATE_READY )
+            // Make sure the session is still alive, otherwise its cook state will never change.
+            if ( FHoudiniApi::IsSessionValid( FHoudiniEngine::Get().GetSession() ) != HAPI_RESULT_SUCCESS )
             {
-                // Cooking has been successful.
-                AddResponseMessageTaskInfo(
-                    HAPI_RESULT_SUCCESS, EHoudiniEngineTaskType::AssetInstantiation,
-                    EHoudiniEngineTaskState::FinishedInstantiation, AssetId, Task,
-                    TEXT( "Finished Instantiation." ) );
-
-                break;
+                bSessionLost = true;
+                return HAPI_STATE_READY_WITH_FATAL_ERRORS;
             }
-            else if ( Status == HAPI_STATE_READY_WITH_FATAL_ERRORS || Status == HAPI_STATE_READY_WITH_COOK_ERRORS )
-            {
-                // There was an error while instantiating.
-                FString CookResultString = FHoudiniEngineUtils::GetCookResult();
-                int32 CookResult = static_cast<int32>(HAPI_RESULT_SUCCESS);
-                FHoudiniApi::GetStatus( FHoudiniEngine::Get().GetSession(), HAPI_STATUS_COOK_RESULT, &CookResult );
 
-                AddResponseMessageTaskInfo(
-                    static_cast<HAPI_Result>(CookResult), EHoudiniEngineTaskType::AssetInstantiation,
-                    EHoudiniEngineTaskState::FinishedInstantiationWithErrors, AssetId, Task,
-                    FString::Printf(TEXT( "Finished Instantiation with Errors: %s" ), *CookResultString ));
+            const FString& CookStateMessage = FHoudiniEngineUtils::GetCookState();
 
-                break;
-            }
-
-            static const double NotificationUpdateFrequency = 0.5;
-            if ( ( FPlatformTime::Seconds() - LastUpdateTime ) >= NotificationUpdateFrequency )
+            for ( int32 TaskIdx = 0; TaskIdx < InstantiationTasks.Num(); ++TaskIdx )
             {
-                // Reset update time.
-                LastUpdateTime = FPlatformTime::Seconds();
-
-                const FString& CookStateMessage = FHoudiniEngineUtils::GetCookState();
+                if ( AssetIds[ TaskIdx ] == -1 )
+                    continue;
 
                 AddResponseMessageTaskInfo(
                     HAPI_RESULT_SUCCESS, EHoudiniEngineTaskType::AssetInstantiation,
-                    EHoudiniEngineTaskState::Processing, AssetId, Task,
+                    EHoudiniEngineTaskState::Processing, AssetIds[ TaskIdx ], InstantiationTasks[ TaskIdx ],
                     CookStateMessage );
             }
-
-            // We want to yield.
-            FPlatformProcess::Sleep( 0.0f );
         }
+
+        // Wait before polling again.
+        PollBackoff.Wait();
     }
-    else
+}
+
+void
+FHoudiniEngineScheduler::TaskInstantiateAsset( const FHoudiniEngineTask & Task )
+{
+    HAPI_NodeId AssetId = -1;
+    if ( !CreateAssetNode( Task, AssetId ) )
+        return;
+
+    TArray< FHoudiniEngineTask > InstantiationTasks;
+    InstantiationTasks.Add( Task );
+
+    TArray< HAPI_NodeId > AssetIds;
+    AssetIds.Add( AssetId );
+
+    bool bSessionLost = false;
+    int32 Status = WaitForInstantiation( InstantiationTasks, AssetIds, bSessionLost );
+
+    GatherQueuedTasks();
+    if ( ConsumeInstantiationInterruption( Task, AssetId ) )
+        return;
+
+    if ( bSessionLost )
     {
         AddResponseMessageTaskInfo(
             HAPI_RESULT_FAILURE, EHoudiniEngineTaskType::AssetInstantiation,
-            EHoudiniEngineTaskState::FinishedInstantiationWithErrors,
-            -1, Task, TEXT( "Error retrieving asset name." ) );
+            EHoudiniEngineTaskState::FinishedInstantiationWithErrors, AssetId, Task,
+            TEXT( "Finished Instantiation with Errors: Houdini Engine session is no longer valid." ) );
+    }
+    else if ( Status == HAPI_STATE_READY )
+    {
+        // Cooking has been successful.
+        AddResponseMessageTaskInfo(
+            HAPI_RESULT_SUCCESS, EHoudiniEngineTaskType::AssetInstantiation,
+            EHoudiniEngineTaskState::FinishedInstantiation, AssetId, Task,
+            TEXT( "Finished Instantiation." ) );
+    }
+    else
+    {
+        // There was an error while instantiating.
+        FString CookResultString = FHoudiniEngineUtils::GetCookResult();
+        int32 CookResult = static_cast<int32>(HAPI_RESULT_SUCCESS);
+        FHoudiniApi::GetStatus( FHoudiniEngine::Get().GetSession(), HAPI_STATUS_COOK_RESULT, &CookResult );
 
+        AddResponseMessageTaskInfo(
+            static_cast<HAPI_Result>(CookResult), EHoudiniEngineTaskType::AssetInstantiation,
+            EHoudiniEngineTaskState::FinishedInstantiationWithErrors, AssetId, Task,
+            FString::Printf(TEXT( "Finished Instantiation with Errors: %s" ), *CookResultString ));
+    }
+}
+
+void
+FHoudiniEngineScheduler::TaskInstantiateAssetBatch( const FHoudiniEngineTask & Task )
+{
+    HOUDINI_LOG_MESSAGE(
+        TEXT( "HAPI Asynchronous Batch Instantiation Started for %d assets." ), Task.BatchTasks.Num() );
+
+    // Create all nodes first, so Houdini can process them while we are still submitting.
+    TArray< HAPI_NodeId > AssetIds;
+    AssetIds.Init( -1, Task.BatchTasks.Num() );
+
+    bool bHasCreatedNodes = false;
+    for ( int32 TaskIdx = 0; TaskIdx < Task.BatchTasks.Num(); ++TaskIdx )
+        bHasCreatedNodes |= CreateAssetNode( Task.BatchTasks[ TaskIdx ], AssetIds[ TaskIdx ] );
+
+    if ( !bHasCreatedNodes )
         return;
+
+    // Then wait on all of them together.
+    bool bSessionLost = false;
+    int32 Status = WaitForInstantiation( Task.BatchTasks, AssetIds, bSessionLost );
+
+    FString CookResultString;
+    int32 CookResult = static_cast<int32>(HAPI_RESULT_SUCCESS);
+    if ( Status != HAPI_STATE_READY && !bSessionLost )
+    {
+        CookResultString = FHoudiniEngineUtils::GetCookResult();
+        FHoudiniApi::GetStatus( FHoudiniEngine::Get().GetSession(), HAPI_STATUS_COOK_RESULT, &CookResult );
     }
+
+    // Members of the batch may have been interrupted or cancelled while we were waiting.
+    GatherQueuedTasks();
+
+    for ( int32 TaskIdx = 0; TaskIdx < Task.BatchTasks.Num(); ++TaskIdx )
+    {
+        HAPI_NodeId AssetId = AssetIds[ TaskIdx ];
+        if ( AssetId == -1 )
+            continue;
+
+        if ( ConsumeInstantiationInterruption( Task.BatchTasks[ TaskIdx ], AssetId ) )
+            continue;
+
+        if ( bSessionLost )
+        {
+            AddResponseMessageTaskInfo(
+                HAPI_RESULT_FAILURE, EHoudiniEngineTaskType::AssetInstantiation,
+                EHoudiniEngineTaskState::FinishedInstantiationWithErrors, AssetId, Task.BatchTasks[ TaskIdx ],
+                TEXT( "Finished Instantiation with Errors: Houdini Engine session is no longer valid." ) );
+            continue;
+        }
+
+        // Cook state is shared by the batch, so attribute errors to the nodes which reported some.
+        bool bNodeHasErrors = false;
+        if ( Status != HAPI_STATE_READY )
+        {
+            int32 BufferLength = 0;
+            if ( FHoudiniApi::ComposeNodeCookResult(
+                FHoudiniEngine::Get().GetSession(), AssetId, HAPI_STATUSVERBOSITY_ERRORS, &BufferLength ) != HAPI_RESULT_SUCCESS
+                || BufferLength > 1 )
+            {
+                bNodeHasErrors = true;
+            }
+        }
+
+        if ( !bNodeHasErrors )
+        {
+            AddResponseMessageTaskInfo(
+                HAPI_RESULT_SUCCESS, EHoudiniEngineTaskType::AssetInstantiation,
+                EHoudiniEngineTaskState::FinishedInstantiation, AssetId, Task.BatchTasks[ TaskIdx ],
+                TEXT( "Finished Instantiation." ) );
+        }
+        else
+        {
+            AddResponseMessageTaskInfo(
+                static_cast<HAPI_Result>(CookResult), EHoudiniEngineTaskType::AssetInstantiation,
+                EHoudiniEngineTaskState::FinishedInstantiationWithErrors, AssetId, Task.BatchTasks[ TaskIdx ],
+                FString::Printf( TEXT( "Finished Instantiation with Errors: %s" ), *CookResultString ) );
+        }
+    }
+}
+
+bool
+FHoudiniEngineScheduler::ConsumeInstantiationInterruption( const FHoudiniEngineTask & Task, HAPI_NodeId AssetId )
+{
+    bool bCancel = false;
+    if ( !InterruptedTasks.RemoveAndCopyValue( Task.HapiGUID, bCancel ) )
+        return false;
+
+    // Nobody is waiting for this node anymore.
+    if ( FHoudiniEngineUtils::IsHoudiniNodeValid( AssetId ) )
+    {
+        HAPI_NodeInfo AssetNodeInfo;
+        FMemory::Memset< HAPI_NodeInfo >( AssetNodeInfo, 0 );
+        FHoudiniApi::GetNodeInfo( FHoudiniEngine::Get().GetSession(), AssetId, &AssetNodeInfo );
+
+        // SOP assets are created inside of their own OBJ node.
+        HAPI_NodeId NodeToDelete = AssetId;
+        if ( AssetNodeInfo.type == HAPI_NODETYPE_SOP )
+        {
+            HAPI_NodeId ParentId = FHoudiniEngineUtils::HapiGetParentNodeId( AssetId );
+            NodeToDelete = ParentId != -1 ? ParentId : AssetId;
+        }
+
+        FHoudiniEngineUtils::DestroyHoudiniAsset( NodeToDelete );
+    }
+
+    HOUDINI_LOG_MESSAGE(
+        TEXT( "HAPI Asynchronous Instantiation %s for %s" ), bCancel ? TEXT( "Cancelled" ) : TEXT( "Interrupted" ),
+        *Task.ActorName );
+
+    if ( bCancel )
+        CancelTask( Task );
+    else
+        DiscardTask( Task );
+
+    return true;
 }
 
 void
@@ -299,12 +499,55 @@ FHoudiniEngineScheduler::TaskCookAsset( const FHoudiniEngineTask & Task )
     // Initialize last update time.
     double LastUpdateTime = FPlatformTime::Seconds();
 
+    // Set once the cook has been interrupted because it became stale, was pre-empted or cancelled.
+    bool bInterrupted = false;
+    bool bRequeue = false;
+    bool bCancel = false;
+
+    FHoudiniEngineStatusPollBackoff PollBackoff;
+
     // We need to spin until cooking is finished.
     while ( true )
     {
         int32 Status = HAPI_STATE_STARTING_COOK;
         HOUDINI_CHECK_ERROR( &Result, FHoudiniApi::GetStatus(
             FHoudiniEngine::Get().GetSession(), HAPI_STATUS_COOK_STATE, &Status ) );
+        INC_DWORD_STAT( STAT_CookStatusPolls );
+
+        if ( Result != HAPI_RESULT_SUCCESS )
+        {
+            // Cook state cannot be retrieved anymore, session is most likely gone.
+            AddResponseMessageTaskInfo(
+                HAPI_RESULT_FAILURE, EHoudiniEngineTaskType::AssetCooking,
+                EHoudiniEngineTaskState::FinishedCookingWithErrors, AssetId, Task,
+                TEXT( "Finished Cooking with Errors: Houdini Engine session is no longer valid." ), 1.0f );
+
+            break;
+        }
+
+        if ( bInterrupted && Status <= HAPI_STATE_MAX_READY_STATE )
+        {
+            if ( bRequeue )
+            {
+                // Cook has been pre-empted, it will be restarted after higher priority tasks.
+                HOUDINI_LOG_MESSAGE( TEXT( "HAPI Asynchronous Cooking Pre-empted for %s, AssetId = %d" ), *Task.ActorName, AssetId );
+                FHoudiniEngineTask PreemptedTask = Task;
+                PreemptedTask.PreemptionCount++;
+                PendingTasks.Insert( PreemptedTask, 0 );
+            }
+            else if ( bCancel )
+            {
+                HOUDINI_LOG_MESSAGE( TEXT( "HAPI Asynchronous Cooking Cancelled for %s, AssetId = %d" ), *Task.ActorName, AssetId );
+                CancelTask( Task );
+            }
+            else
+            {
+                HOUDINI_LOG_MESSAGE( TEXT( "HAPI Asynchronous Cooking Interrupted for %s, AssetId = %d" ), *Task.ActorName, AssetId );
+                DiscardTask( Task );
+            }
+
+            break;
+        }
 
         if ( Status == HAPI_STATE_READY )
         {
@@ -312,7 +555,7 @@ FHoudiniEngineScheduler::TaskCookAsset( const FHoudiniEngineTask & Task )
             AddResponseMessageTaskInfo(
                 HAPI_RESULT_SUCCESS, EHoudiniEngineTaskType::AssetCooking,
                 EHoudiniEngineTaskState::FinishedCooking, AssetId, Task,
-                TEXT( "Finished Cooking" ) );
+                TEXT( "Finished Cooking" ), 1.0f );
 
             break;
         }
@@ -322,28 +565,46 @@ FHoudiniEngineScheduler::TaskCookAsset( const FHoudiniEngineTask & Task )
             AddResponseMessageTaskInfo(
                 HAPI_RESULT_SUCCESS, EHoudiniEngineTaskType::AssetCooking,
                 EHoudiniEngineTaskState::FinishedCookingWithErrors, AssetId, Task,
-                TEXT( "Finished Cooking with Errors" ) );
+                TEXT( "Finished Cooking with Errors" ), 1.0f );
 
             break;
         }
 
+        // Interrupt the cook if a newer cook of this asset or a higher priority task is waiting.
+        if ( !bInterrupted && ShouldInterruptCook( Task, bRequeue, bCancel ) )
+        {
+            FHoudiniApi::Interrupt( FHoudiniEngine::Get().GetSession() );
+            bInterrupted = true;
+        }
+
         static const double NotificationUpdateFrequency = 0.5;
         if ( FPlatformTime::Seconds() - LastUpdateTime >= NotificationUpdateFrequency )
         {
             // Reset update time.
             LastUpdateTime = FPlatformTime::Seconds();
 
+            // Make sure the session is still alive, otherwise its cook state will never change.
+            if ( FHoudiniApi::IsSessionValid( FHoudiniEngine::Get().GetSession() ) != HAPI_RESULT_SUCCESS )
+            {
+                AddResponseMessageTaskInfo(
+                    HAPI_RESULT_FAILURE, EHoudiniEngineTaskType::AssetCooking,
+                    EHoudiniEngineTaskState::FinishedCookingWithErrors, AssetId, Task,
+                    TEXT( "Finished Cooking with Errors: Houdini Engine session is no longer valid." ), 1.0f );
+
+                break;
+            }
+
             // Retrieve status string.
             const FString & CookStateMessage = FHoudiniEngineUtils::GetCookState();
 
             AddResponseMessageTaskInfo(
                 HAPI_RESULT_SUCCESS, EHoudiniEngineTaskType::AssetCooking,
                 EHoudiniEngineTaskState::Processing, AssetId, Task,
-                CookStateMessage );
+                CookStateMessage, GetCookProgress() );
         }
 
-        // We want to yield.
-        FPlatformProcess::Sleep( 0.0f );
+        // Wait before polling again.
+        PollBackoff.Wait();
     }
 }
 
@@ -362,6 +623,24 @@ FHoudiniEngineScheduler::TaskDeleteAsset( const FHoudiniEngineTask & Task )
     // At this point component most likely does not exist.
 }
 
+void
+FHoudiniEngineScheduler::TaskLoadAssetLibrary( const FHoudiniEngineTask & Task )
+{
+    UHoudiniAsset * HoudiniAsset = Task.Asset.Get();
+    if ( !HoudiniAsset )
+        return;
+
+    HAPI_AssetLibraryId AssetLibraryId = -1;
+    if ( !FHoudiniEngineUtils::LoadAssetLibrary( HoudiniAsset, AssetLibraryId ) )
+    {
+        HOUDINI_LOG_WARNING(
+            TEXT( "Preloading asset library of %s failed in session %d." ),
+            *HoudiniAsset->GetName(), SessionIndex );
+    }
+
+    // We do not insert task info, nobody is waiting for this task.
+}
+
 void
 FHoudiniEngineScheduler::AddResponseTaskInfo(
     HAPI_Result Result, EHoudiniEngineTaskType::Type TaskType, EHoudiniEngineTaskState::Type TaskState,
@@ -378,9 +657,10 @@ FHoudiniEngineScheduler::AddResponseTaskInfo(
 void
 FHoudiniEngineScheduler::AddResponseMessageTaskInfo(
     HAPI_Result Result, EHoudiniEngineTaskType::Type TaskType, EHoudiniEngineTaskState::Type TaskState,
-    HAPI_NodeId AssetId, const FHoudiniEngineTask & Task, const FString & ErrorMessage )
+    HAPI_NodeId AssetId, const FHoudiniEngineTask & Task, const FString & ErrorMessage, float Progress )
 {
     FHoudiniEngineTaskInfo TaskInfo( Result, AssetId, TaskType, TaskState );
+    TaskInfo.Progress = Progress;
 
     TaskInfo.bLoadedComponent = Task.bLoadedComponent;
     TaskDescription( TaskInfo, Task.ActorName, ErrorMessage );
@@ -392,24 +672,29 @@ FHoudiniEngineScheduler::ProcessQueuedTasks()
 {
     while( !bStopping )
     {
-        while ( true )
+        // Sessions are not usable until warm-up is done, keep tasks queued meanwhile.
+        if ( FHoudiniEngine::Get().IsWarmingUpSessions() )
         {
-            FHoudiniEngineTask Task;
+            if ( !FPlatformProcess::SupportsMultithreading() )
+                return;
 
-            {
-                FScopeLock ScopeLock( &CriticalSection );
+            FPlatformProcess::Sleep( 0.01f );
+            continue;
+        }
 
-                // We have no tasks left.
-                if ( PositionWrite == PositionRead )
-                    break;
+        while ( true )
+        {
+            FHoudiniEngineTask Task;
 
-                // Retrieve task.
-                Task = Tasks[ PositionRead ];
-                PositionRead++;
+            // Tasks are only picked up while our session is not being restarted.
+            WaitWhilePaused();
+            if ( bStopping )
+                break;
 
-                // Wrap around if required.
-                PositionRead &= ( TaskCount - 1 );
-            }
+            // Retrieve task, we have no tasks left if nothing is pending.
+            GatherQueuedTasks();
+            if ( !PopPendingTask( Task ) )
+                break;
 
             bool bTaskProcessed = true;
 
@@ -421,6 +706,12 @@ FHoudiniEngineScheduler::ProcessQueuedTasks()
                     break;
                 }
 
+                case EHoudiniEngineTaskType::AssetBatchInstantiation:
+                {
+                    TaskInstantiateAssetBatch( Task );
+                    break;
+                }
+
                 case EHoudiniEngineTaskType::AssetCooking:
                 {
                     TaskCookAsset( Task );
@@ -433,6 +724,12 @@ FHoudiniEngineScheduler::ProcessQueuedTasks()
                     break;
                 }
 
+                case EHoudiniEngineTaskType::AssetLibraryLoading:
+                {
+                    TaskLoadAssetLibrary( Task );
+                    break;
+                }
+
                 default:
                 {
                     bTaskProcessed = false;
@@ -440,14 +737,18 @@ FHoudiniEngineScheduler::ProcessQueuedTasks()
                 }
             }
 
+            // Interruption requests which were not consumed refer to tasks which are already done.
+            InterruptedTasks.Empty();
+
             if ( !bTaskProcessed )
                 break;
         }
 
         if ( FPlatformProcess::SupportsMultithreading() )
         {
-            // We want to yield for a bit.
-            FPlatformProcess::Sleep( 0.0f );
+            // Sleep until new tasks are added or we are asked to stop or pause.
+            if ( Tasks.IsEmpty() && PendingTasks.Num() == 0 && !bStopping && !bPauseRequested && TaskEvent )
+                TaskEvent->Wait();
         }
         else
         {
@@ -460,62 +761,297 @@ FHoudiniEngineScheduler::ProcessQueuedTasks()
 void
 FHoudiniEngineScheduler::AddTask( const FHoudiniEngineTask & Task )
 {
-    FScopeLock ScopeLock( &CriticalSection );
+    // Queue grows as needed, tasks are never dropped.
+    Tasks.Enqueue( Task );
+
+    // Wake up scheduler thread.
+    if ( TaskEvent )
+        TaskEvent->Trigger();
+}
+
+void
+FHoudiniEngineScheduler::InterruptTask( const FGuid & HapiGUID, bool bCancel )
+{
+    InterruptRequests.Enqueue( TPair< FGuid, bool >( HapiGUID, bCancel ) );
+}
+
+bool
+FHoudiniEngineScheduler::Pause( float Timeout )
+{
+    // In single threaded mode tasks are processed on the game thread, so they cannot run concurrently.
+    if ( !FPlatformProcess::SupportsMultithreading() )
+        return true;
 
-    // Check if we need to grow our circular buffer.
-    if ( PositionWrite + 1 == PositionRead )
     {
-        // Calculate next size (next power of two).
-        uint32 NextTaskCount = FPlatformMath::RoundUpToPowerOfTwo( TaskCount + 1 );
+        FScopeLock ScopeLock( &PauseCriticalSection );
+        bPauseRequested = true;
+    }
 
-        // Allocate new buffer.
-        FHoudiniEngineTask * Buffer = static_cast< FHoudiniEngineTask * >(
-            FMemory::Malloc( NextTaskCount * sizeof( FHoudiniEngineTask ) ) );
+    // Wake up scheduler thread if it is sleeping on an empty queue.
+    if ( TaskEvent )
+        TaskEvent->Trigger();
 
-        if( !Buffer )
-            return;
+    const double EndTime = FPlatformTime::Seconds() + Timeout;
+    while ( true )
+    {
+        {
+            FScopeLock ScopeLock( &PauseCriticalSection );
+            if ( bPaused )
+                return true;
+        }
 
-        // Zero memory.
-        FMemory::Memset( Buffer, 0x0, NextTaskCount * sizeof( FHoudiniEngineTask ) );
+        const double RemainingTime = EndTime - FPlatformTime::Seconds();
+        if ( RemainingTime <= 0.0 || !PausedEvent )
+            break;
+
+        PausedEvent->Wait( (uint32) FMath::CeilToInt( RemainingTime * 1000.0 ) );
+    }
+
+    Resume();
+    return false;
+}
+
+void
+FHoudiniEngineScheduler::Resume()
+{
+    {
+        FScopeLock ScopeLock( &PauseCriticalSection );
+        bPauseRequested = false;
+    }
 
-        // Copy elements from old buffer to new one.
-        if ( PositionRead < PositionWrite )
+    if ( ResumeEvent )
+        ResumeEvent->Trigger();
+}
+
+void
+FHoudiniEngineScheduler::WaitWhilePaused()
+{
+    while ( true )
+    {
         {
-            FMemory::Memcpy( Buffer, Tasks + PositionRead, sizeof( FHoudiniEngineTask ) * ( PositionWrite - PositionRead ) );
+            // State is checked and updated under the lock, a pause requested right after a resume
+            // either keeps us parked or waits for us to park again.
+            FScopeLock ScopeLock( &PauseCriticalSection );
+            if ( !bPauseRequested || bStopping || !ResumeEvent )
+            {
+                bPaused = false;
+                return;
+            }
 
-            // Update index positions.
-            PositionRead = 0;
-            PositionWrite = PositionWrite - PositionRead;
+            bPaused = true;
         }
-        else
+
+        if ( PausedEvent )
+            PausedEvent->Trigger();
+
+        // Stale triggers only cause the state to be checked again.
+        ResumeEvent->Wait();
+    }
+}
+
+void
+FHoudiniEngineScheduler::DrainTasks( TArray< FHoudiniEngineTask > & OutTasks )
+{
+    FHoudiniEngineTask Task;
+    while ( Tasks.Dequeue( Task ) )
+        PendingTasks.Add( Task );
+
+    OutTasks.Append( PendingTasks );
+    PendingTasks.Empty();
+
+    // Interruption requests refer to tasks of this scheduler only.
+    TPair< FGuid, bool > InterruptRequest;
+    while ( InterruptRequests.Dequeue( InterruptRequest ) )
+        continue;
+
+    InterruptedTasks.Empty();
+}
+
+void
+FHoudiniEngineScheduler::GatherQueuedTasks()
+{
+    FHoudiniEngineTask Task;
+    while ( Tasks.Dequeue( Task ) )
+    {
+        if ( Task.TaskType == EHoudiniEngineTaskType::AssetCooking )
         {
-            FMemory::Memcpy( Buffer, Tasks + PositionRead, sizeof( FHoudiniEngineTask ) * ( TaskCount - PositionRead ) );
-            FMemory::Memcpy( Buffer + TaskCount - PositionRead, Tasks, sizeof( FHoudiniEngineTask ) * PositionWrite );
+            int32 PendingIdx = PendingTasks.IndexOfByPredicate( [ &Task ]( const FHoudiniEngineTask & PendingTask )
+            {
+                return PendingTask.TaskType == EHoudiniEngineTaskType::AssetCooking && PendingTask.AssetId == Task.AssetId;
+            } );
+
+            if ( PendingIdx != INDEX_NONE )
+            {
+                // Collapse the pending cook into the latest one, keeping its place in the queue.
+                FHoudiniEngineTask & PendingTask = PendingTasks[ PendingIdx ];
+                if ( PendingTask.Priority > Task.Priority )
+                    Task.Priority = PendingTask.Priority;
+
+                Task.PreemptionCount = FMath::Max( Task.PreemptionCount, PendingTask.PreemptionCount );
 
-            // Update index positions.
-            PositionRead = 0;
-            PositionWrite = TaskCount - PositionRead + PositionWrite;
+                DiscardTask( PendingTask );
+                PendingTask = Task;
+                continue;
+            }
         }
 
-        // Deallocate old buffer.
-        FMemory::Free( Tasks );
+        PendingTasks.Add( Task );
+    }
 
-        // Bookkeeping.
-        Tasks = Buffer;
-        TaskCount = NextTaskCount;
+    TPair< FGuid, bool > InterruptRequest;
+    while ( InterruptRequests.Dequeue( InterruptRequest ) )
+    {
+        const FGuid & HapiGUID = InterruptRequest.Key;
+        const bool bCancel = InterruptRequest.Value;
+
+        int32 PendingIdx = PendingTasks.IndexOfByPredicate( [ &HapiGUID ]( const FHoudiniEngineTask & PendingTask )
+        {
+            return PendingTask.HapiGUID == HapiGUID;
+        } );
+
+        if ( PendingIdx != INDEX_NONE )
+        {
+            // Task has not started yet, we can simply drop it.
+            if ( bCancel )
+                CancelTask( PendingTasks[ PendingIdx ] );
+            else
+                DiscardTask( PendingTasks[ PendingIdx ] );
+
+            PendingTasks.RemoveAt( PendingIdx );
+        }
+        else if ( RemovePendingBatchedTask( HapiGUID, bCancel ) )
+        {
+            // Task was waiting inside of a batch which has not started yet.
+        }
+        else
+        {
+            // Task may be running, it will be checked by the cook loop. Cancellation wins over staleness.
+            bool & bInterruptedCancel = InterruptedTasks.FindOrAdd( HapiGUID );
+            bInterruptedCancel |= bCancel;
+        }
     }
+}
+
+bool
+FHoudiniEngineScheduler::RemovePendingBatchedTask( const FGuid & HapiGUID, bool bCancel )
+{
+    for ( int32 PendingIdx = 0; PendingIdx < PendingTasks.Num(); ++PendingIdx )
+    {
+        FHoudiniEngineTask & PendingTask = PendingTasks[ PendingIdx ];
+        int32 BatchedIdx = PendingTask.BatchTasks.IndexOfByPredicate( [ &HapiGUID ]( const FHoudiniEngineTask & BatchedTask )
+        {
+            return BatchedTask.HapiGUID == HapiGUID;
+        } );
+
+        if ( BatchedIdx == INDEX_NONE )
+            continue;
 
-    // Store task.
-    Tasks[ PositionWrite ] = Task;
-    PositionWrite++;
+        if ( bCancel )
+            CancelTask( PendingTask.BatchTasks[ BatchedIdx ] );
+        else
+            DiscardTask( PendingTask.BatchTasks[ BatchedIdx ] );
 
-    // Wrap around if required.
-    PositionWrite &= ( TaskCount - 1 );
+        // Remaining members of the batch are still instantiated together.
+        PendingTask.BatchTasks.RemoveAt( BatchedIdx );
+        if ( PendingTask.BatchTasks.Num() == 0 )
+            PendingTasks.RemoveAt( PendingIdx );
+
+        return true;
+    }
+
+    return false;
+}
+
+bool
+FHoudiniEngineScheduler::PopPendingTask( FHoudiniEngineTask & Task )
+{
+    int32 BestIdx = INDEX_NONE;
+    for ( int32 Idx = 0; Idx < PendingTasks.Num(); ++Idx )
+    {
+        if ( BestIdx == INDEX_NONE || PendingTasks[ Idx ].Priority > PendingTasks[ BestIdx ].Priority )
+            BestIdx = Idx;
+    }
+
+    if ( BestIdx == INDEX_NONE )
+        return false;
+
+    Task = PendingTasks[ BestIdx ];
+    PendingTasks.RemoveAt( BestIdx );
+    return true;
+}
+
+bool
+FHoudiniEngineScheduler::ShouldInterruptCook( const FHoudiniEngineTask & Task, bool & bRequeue, bool & bCancel )
+{
+    GatherQueuedTasks();
+
+    bRequeue = false;
+    bCancel = false;
+
+    // Interruption has been explicitly requested.
+    if ( InterruptedTasks.RemoveAndCopyValue( Task.HapiGUID, bCancel ) )
+        return true;
+
+    for ( const FHoudiniEngineTask & PendingTask : PendingTasks )
+    {
+        // A newer cook of the same asset is waiting, this cook is stale.
+        if ( PendingTask.TaskType == EHoudiniEngineTaskType::AssetCooking && PendingTask.AssetId == Task.AssetId )
+            return true;
+    }
+
+    // A cook which has already been restarted too many times runs to completion, so it cannot starve.
+    if ( Task.PreemptionCount >= HAPI_UNREAL_COOK_MAX_PREEMPTIONS )
+        return false;
+
+    for ( const FHoudiniEngineTask & PendingTask : PendingTasks )
+    {
+        // A cook of an asset the user is working on is waiting, pre-empt this cook and restart it later.
+        if ( PendingTask.TaskType == EHoudiniEngineTaskType::AssetCooking &&
+            PendingTask.Priority == EHoudiniEngineTaskPriority::High && PendingTask.Priority > Task.Priority )
+        {
+            bRequeue = true;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void
+FHoudiniEngineScheduler::DiscardTask( const FHoudiniEngineTask & Task )
+{
+    FHoudiniEngine::Get().DiscardTaskInfo( Task.HapiGUID );
+}
+
+void
+FHoudiniEngineScheduler::CancelTask( const FHoudiniEngineTask & Task )
+{
+    AddResponseMessageTaskInfo(
+        HAPI_RESULT_SUCCESS, Task.TaskType, EHoudiniEngineTaskState::Aborted,
+        Task.AssetId, Task, TEXT( "Cancelled" ) );
+}
+
+float
+FHoudiniEngineScheduler::GetCookProgress() const
+{
+    int32 TotalCount = 0;
+    int32 CurrentCount = 0;
+
+    if ( FHoudiniApi::GetCookingTotalCount( FHoudiniEngine::Get().GetSession(), &TotalCount ) != HAPI_RESULT_SUCCESS
+        || FHoudiniApi::GetCookingCurrentCount( FHoudiniEngine::Get().GetSession(), &CurrentCount ) != HAPI_RESULT_SUCCESS )
+        return 0.0f;
+
+    if ( TotalCount <= 0 )
+        return 0.0f;
+
+    return FMath::Clamp( (float) CurrentCount / (float) TotalCount, 0.0f, 1.0f );
 }
 
 uint32
 FHoudiniEngineScheduler::Run()
 {
+    // Bind this thread to the session of the pool we are processing tasks for.
+    FHoudiniEngineScopedSession ScopedSession( SessionIndex );
     ProcessQueuedTasks();
     return 0;
 }
@@ -524,11 +1060,19 @@ void
 FHoudiniEngineScheduler::Stop()
 {
     bStopping = true;
+
+    // Wake up scheduler thread so it can exit, it may be sleeping or parked.
+    if ( TaskEvent )
+        TaskEvent->Trigger();
+
+    if ( ResumeEvent )
+        ResumeEvent->Trigger();
 }
 
 void
 FHoudiniEngineScheduler::Tick()
 {
+    FHoudiniEngineScopedSession ScopedSession( SessionIndex );
     ProcessQueuedTasks();
 }
 
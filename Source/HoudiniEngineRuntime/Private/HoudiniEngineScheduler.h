@@ -35,14 +35,39 @@
 #include "HoudiniEngineTaskInfo.h"
 #include "HAL/Runnable.h"
 #include "HAL/RunnableThread.h"
+#include "HAL/Event.h"
+#include "HAL/ThreadSafeBool.h"
+#include "Containers/Queue.h"
 #include "SingleThreadRunnable.h"
 
 
+/** Adaptive delay between cook status polls: first poll only yields, then the delay grows **/
+/** exponentially up to a cap, so short cooks return quickly and long ones do not flood the session. **/
+struct FHoudiniEngineStatusPollBackoff
+{
+    FHoudiniEngineStatusPollBackoff();
+
+    /** Wait before the next poll and grow the delay. **/
+    void Wait();
+
+    /** Current delay, in seconds. **/
+    float Interval;
+
+    /** Delay used after the first poll, in seconds. **/
+    float MinInterval;
+
+    /** Maximum delay, in seconds. **/
+    float MaxInterval;
+
+    /** Factor applied to the delay after each poll. **/
+    float BackoffFactor;
+};
+
 class FHoudiniEngineScheduler : public FRunnable, FSingleThreadRunnable
 {
     public:
 
-        FHoudiniEngineScheduler();
+        FHoudiniEngineScheduler( int32 InSessionIndex = 0 );
         virtual ~FHoudiniEngineScheduler();
 
     /** FRunnable methods. **/
@@ -62,6 +87,20 @@ class FHoudiniEngineScheduler : public FRunnable, FSingleThreadRunnable
         /** Add a task. **/
         void AddTask( const FHoudiniEngineTask & Task );
 
+        /** Request interruption of a queued or running task, unknown tasks are ignored. Cancelled tasks **/
+        /** are reported as aborted, otherwise they are silently discarded.                              **/
+        void InterruptTask( const FGuid & HapiGUID, bool bCancel );
+
+        /** Wait until scheduler thread is idle between tasks and keep it parked, so that its session can be **/
+        /** restarted. Returns false, and lets the thread run again, if it did not park within given time.  **/
+        bool Pause( float Timeout );
+
+        /** Let a paused scheduler thread resume processing tasks. **/
+        void Resume();
+
+        /** Remove all queued and pending tasks. Only valid once scheduler thread has exited. **/
+        void DrainTasks( TArray< FHoudiniEngineTask > & OutTasks );
+
         /** Add instantiation response task info. **/
         void AddResponseTaskInfo(
             HAPI_Result Result, EHoudiniEngineTaskType::Type TaskType,
@@ -71,16 +110,57 @@ class FHoudiniEngineScheduler : public FRunnable, FSingleThreadRunnable
         void AddResponseMessageTaskInfo(
             HAPI_Result Result, EHoudiniEngineTaskType::Type TaskType,
             EHoudiniEngineTaskState::Type TaskState, HAPI_NodeId AssetId, const FHoudiniEngineTask & Task,
-            const FString & ErrorMessage );
+            const FString & ErrorMessage, float Progress = 0.0f );
 
     protected:
 
         /** Process queued tasks. **/
         void ProcessQueuedTasks();
 
+        /** Move newly added tasks into the pending list, coalescing cooks of the same asset. **/
+        void GatherQueuedTasks();
+
+        /** Park scheduler thread while a pause is requested. **/
+        void WaitWhilePaused();
+
+        /** Remove a task waiting inside of a pending batch, returns false if no batch contains it. **/
+        bool RemovePendingBatchedTask( const FGuid & HapiGUID, bool bCancel );
+
+        /** Retrieve the pending task with highest priority, oldest first. **/
+        bool PopPendingTask( FHoudiniEngineTask & Task );
+
+        /** Return true if running cook should be interrupted, bRequeue is set if it was pre-empted **/
+        /** and bCancel if it was cancelled.                                                        **/
+        bool ShouldInterruptCook( const FHoudiniEngineTask & Task, bool & bRequeue, bool & bCancel );
+
+        /** Report a task as aborted after it has been cancelled. **/
+        void CancelTask( const FHoudiniEngineTask & Task );
+
+        /** Return progress of the current cook, based on the number of cooked nodes. **/
+        float GetCookProgress() const;
+
+        /** Drop a task which will not be completed, its owner is notified on the next frame. **/
+        void DiscardTask( const FHoudiniEngineTask & Task );
+
         /** Task : instantiate an asset. **/
         void TaskInstantiateAsset( const FHoudiniEngineTask & Task );
 
+        /** Task : instantiate a batch of assets, all nodes are created before waiting for them. **/
+        void TaskInstantiateAssetBatch( const FHoudiniEngineTask & Task );
+
+        /** Create the node of an instantiation task, responds with an error on failure. **/
+        bool CreateAssetNode( const FHoudiniEngineTask & Task, HAPI_NodeId & AssetId );
+
+        /** Wait until created nodes have been instantiated, returns final cook state. Stops waiting and sets **/
+        /** bSessionLost if the session can no longer report its cook state.                                  **/
+        int32 WaitForInstantiation(
+            const TArray< FHoudiniEngineTask > & InstantiationTasks, const TArray< HAPI_NodeId > & AssetIds,
+            bool & bSessionLost );
+
+        /** If interruption of an instantiation task has been requested, destroy its node and report it as **/
+        /** cancelled or discard it. Returns false if the task has not been interrupted.                      **/
+        bool ConsumeInstantiationInterruption( const FHoudiniEngineTask & Task, HAPI_NodeId AssetId );
+
         /** Task : cook an asset. **/
         void TaskCookAsset( const FHoudiniEngineTask & Task );
 
@@ -90,28 +170,44 @@ class FHoudiniEngineScheduler : public FRunnable, FSingleThreadRunnable
         /** Delete an asset. **/
         void TaskDeleteAsset( const FHoudiniEngineTask & Task );
 
-    protected:
-
-        /** Initial number of tasks in our circular queue. **/
-        static const uint32 InitialTaskSize;
+        /** Load asset library of an asset, so later instantiations do not have to. **/
+        void TaskLoadAssetLibrary( const FHoudiniEngineTask & Task );
 
     protected:
 
-        /** Synchronization primitive. **/
-        FCriticalSection CriticalSection;
+        /** Lock-free queue of scheduled tasks, any thread can produce, only scheduler thread consumes. **/
+        TQueue< FHoudiniEngineTask, EQueueMode::Mpsc > Tasks;
 
-        /** List of scheduled tasks. **/
-        FHoudiniEngineTask* Tasks;
+        /** Event used to wake up scheduler thread when tasks are added or when stopping. **/
+        FEvent * TaskEvent;
 
-        /** Head of the circular queue. **/
-        uint32 PositionWrite;
+        /** Tasks moved out of the queue, waiting to be processed. Only used by scheduler thread. **/
+        TArray< FHoudiniEngineTask > PendingTasks;
 
-        /** Tail of the circular queue. **/
-        uint32 PositionRead;
+        /** Lock-free queue of interruption requests, with their cancel flag. **/
+        TQueue< TPair< FGuid, bool >, EQueueMode::Mpsc > InterruptRequests;
 
-        /** Size of the circular queue. **/
-        uint32 TaskCount;
+        /** Tasks whose interruption has been requested, with their cancel flag. Only used by scheduler thread. **/
+        TMap< FGuid, bool > InterruptedTasks;
+
+        /** Index of the session this scheduler processes tasks on. **/
+        int32 SessionIndex;
 
         /** Stopping flag. **/
         bool bStopping;
+
+        /** Set while a pause of scheduler thread is requested. **/
+        FThreadSafeBool bPauseRequested;
+
+        /** Set while scheduler thread is parked. Guarded by PauseCriticalSection. **/
+        bool bPaused;
+
+        /** Guards transitions between paused and running states. **/
+        FCriticalSection PauseCriticalSection;
+
+        /** Event triggered by scheduler thread once it is parked. **/
+        FEvent * PausedEvent;
+
+        /** Event used to wake up a parked scheduler thread. **/
+        FEvent * ResumeEvent;
 };
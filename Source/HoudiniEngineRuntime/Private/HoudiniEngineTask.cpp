@@ -39,6 +39,9 @@ FHoudiniEngineTask::FHoudiniEngineTask()
     , AssetLibraryId( -1 )
     , AssetHapiName( -1 )
     , bLoadedComponent( false )
+    , SessionIndex( 0 )
+    , Priority( EHoudiniEngineTaskPriority::Normal )
+    , PreemptionCount( 0 )
 {
     HapiGUID.Invalidate();
 }
@@ -51,4 +54,7 @@ FHoudiniEngineTask::FHoudiniEngineTask( EHoudiniEngineTaskType::Type InTaskType,
     , AssetLibraryId( -1 )
     , AssetHapiName( -1 )
     , bLoadedComponent( false )
+    , SessionIndex( 0 )
+    , Priority( EHoudiniEngineTaskPriority::Normal )
+    , PreemptionCount( 0 )
 {}
@@ -38,6 +38,7 @@ FHoudiniEngineTaskInfo::FHoudiniEngineTaskInfo()
     , AssetId( -1 )
     , TaskType( EHoudiniEngineTaskType::None )
     , TaskState( EHoudiniEngineTaskState::None )
+    , Progress( 0.0f )
     , bLoadedComponent( false )
 {}
 
@@ -49,5 +50,6 @@ FHoudiniEngineTaskInfo::FHoudiniEngineTaskInfo(
     , AssetId( InAssetId )
     , TaskType( InTaskType )
     , TaskState( InTaskState )
+    , Progress( 0.0f )
     , bLoadedComponent( false )
 {}
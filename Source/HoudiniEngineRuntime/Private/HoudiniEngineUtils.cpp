@@ -34,6 +34,7 @@
 #include "HoudiniLandscapeUtils.h"
 #include "HoudiniEngineBakeUtils.h"
 #include "HoudiniEngineMaterialUtils.h"
+#include "HoudiniMeshConversionUtils.h"
 #include "Components/SplineComponent.h"
 #include "LandscapeInfo.h"
 #include "LandscapeComponent.h"
@@ -76,12 +77,21 @@
 
 #include "HAL/PlatformMisc.h"
 #include "HAL/PlatformApplicationMisc.h"
+#include "Async/Async.h"
+#include "Async/ParallelFor.h"
+#include "Misc/ScopedSlowTask.h"
+#include "Misc/MemStack.h"
+#include "Hash/CityHash.h"
 
 #include "Internationalization.h"
 
 #define LOCTEXT_NAMESPACE HOUDINI_LOCTEXT_NAMESPACE 
 
 DECLARE_CYCLE_STAT( TEXT( "Houdini: Build Static Mesh" ), STAT_BuildStaticMesh, STATGROUP_HoudiniEngine );
+DECLARE_CYCLE_STAT( TEXT( "Houdini: Build Split Group Raw Meshes" ), STAT_BuildSplitGroupRawMeshes, STATGROUP_HoudiniEngine );
+DECLARE_DWORD_ACCUMULATOR_STAT( TEXT( "Houdini: Cook Arena Scopes" ), STAT_CookArenaScopes, STATGROUP_HoudiniEngine );
+DECLARE_DWORD_ACCUMULATOR_STAT( TEXT( "Houdini: Cook Arena String Allocations" ), STAT_CookArenaStringAllocations, STATGROUP_HoudiniEngine );
+DECLARE_MEMORY_STAT( TEXT( "Houdini: Cook Arena Last Scope Memory" ), STAT_CookArenaLastScopeMemory, STATGROUP_HoudiniEngine );
 
 const FString kResultStringSuccess( TEXT( "Success" ) );
 const FString kResultStringFailure( TEXT( "Generic Failure" ) );
@@ -185,8 +195,9 @@ FHoudiniEngineUtils::GetCookResult()
 bool
 FHoudiniEngineUtils::IsInitialized()
 {
-    return ( FHoudiniApi::IsHAPIInitialized() &&
-        FHoudiniApi::IsInitialized( FHoudiniEngine::Get().GetSession() ) == HAPI_RESULT_SUCCESS );
+    // Session is not available while it is warming up.
+    const HAPI_Session * SessionPtr = FHoudiniApi::IsHAPIInitialized() ? FHoudiniEngine::Get().GetSession() : nullptr;
+    return SessionPtr && FHoudiniApi::IsInitialized( SessionPtr ) == HAPI_RESULT_SUCCESS;
 }
 
 bool
@@ -651,10 +662,11 @@ FHoudiniEngineUtils::HapiGetGroupNames(
     return true;
 }
 
+template< typename AllocatorType >
 bool
 FHoudiniEngineUtils::HapiGetGroupMembership(
     HAPI_NodeId AssetId, HAPI_NodeId ObjectId, HAPI_NodeId GeoId, HAPI_PartId PartId,
-    HAPI_GroupType GroupType, const FString & GroupName, TArray< int32 > & GroupMembership )
+    HAPI_GroupType GroupType, const FString & GroupName, TArray< int32, AllocatorType > & GroupMembership )
 {
     HAPI_PartInfo PartInfo;
     HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::GetPartInfo(
@@ -683,6 +695,11 @@ FHoudiniEngineUtils::HapiGetGroupMembership(
     return true;
 }
 
+template bool FHoudiniEngineUtils::HapiGetGroupMembership< FDefaultAllocator >(
+    HAPI_NodeId, HAPI_NodeId, HAPI_NodeId, HAPI_PartId, HAPI_GroupType, const FString &, TArray< int32, FDefaultAllocator > & );
+template bool FHoudiniEngineUtils::HapiGetGroupMembership< FHoudiniCookArenaAllocator >(
+    HAPI_NodeId, HAPI_NodeId, HAPI_NodeId, HAPI_PartId, HAPI_GroupType, const FString &, TArray< int32, FHoudiniCookArenaAllocator > & );
+
 bool
 FHoudiniEngineUtils::HapiCheckGroupMembership(
     const FHoudiniGeoPartObject & HoudiniGeoPartObject, HAPI_GroupType GroupType, const FString & GroupName )
@@ -697,7 +714,8 @@ FHoudiniEngineUtils::HapiCheckGroupMembership(
     HAPI_NodeId AssetId, HAPI_NodeId ObjectId, HAPI_NodeId GeoId, HAPI_PartId PartId,
     HAPI_GroupType GroupType, const FString & GroupName )
 {
-    TArray< int32 > GroupMembership;
+    FMemMark ArenaMark( FMemStack::Get() );
+    TArray< int32, FHoudiniCookArenaAllocator > GroupMembership;
     if ( FHoudiniEngineUtils::HapiGetGroupMembership( AssetId, ObjectId, GeoId, PartId, GroupType, GroupName, GroupMembership ) )
     {
         int32 GroupSum = 0;
@@ -863,6 +881,55 @@ FHoudiniEngineUtils::HapiGetAttributeDataAsFloat(
         ResultAttributeInfo, Data, TupleSize, Owner );
 }
 
+bool
+FHoudiniEngineUtils::HapiGetAttributeDataAsFloat(
+    HAPI_NodeId AssetId, HAPI_NodeId ObjectId, HAPI_NodeId GeoId,
+    HAPI_PartId PartId, const char * Name, HAPI_AttributeInfo & ResultAttributeInfo,
+    TArray< FVector > & Data, HAPI_AttributeOwner Owner )
+{
+    ResultAttributeInfo.exists = false;
+
+    // Reset container size.
+    Data.SetNumUninitialized( 0 );
+
+    HAPI_AttributeInfo AttributeInfo;
+    FMemory::Memzero< HAPI_AttributeInfo >( AttributeInfo );
+
+    if ( Owner == HAPI_ATTROWNER_INVALID )
+    {
+        for ( int32 AttrIdx = 0; AttrIdx < HAPI_ATTROWNER_MAX; ++AttrIdx )
+        {
+            HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::GetAttributeInfo(
+                FHoudiniEngine::Get().GetSession(), GeoId, PartId, Name,
+                (HAPI_AttributeOwner) AttrIdx, &AttributeInfo ), false );
+
+            if ( AttributeInfo.exists )
+                break;
+        }
+    }
+    else
+    {
+        HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::GetAttributeInfo(
+            FHoudiniEngine::Get().GetSession(), GeoId, PartId, Name,
+            Owner, &AttributeInfo ), false );
+    }
+
+    if ( !AttributeInfo.exists || AttributeInfo.count <= 0 )
+        return false;
+
+    // HAPI writes the tuples with the same packed layout as FVector.
+    AttributeInfo.tupleSize = 3;
+    Data.SetNumUninitialized( AttributeInfo.count );
+
+    HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::GetAttributeFloatData(
+        FHoudiniEngine::Get().GetSession(), GeoId, PartId, Name,
+        &AttributeInfo, -1, (float *) Data.GetData(), 0, AttributeInfo.count ), false );
+
+    // Store the retrieved attribute information.
+    ResultAttributeInfo = AttributeInfo;
+    return true;
+}
+
 bool
 FHoudiniEngineUtils::HapiGetAttributeDataAsInteger(
     HAPI_NodeId AssetId, HAPI_NodeId ObjectId, HAPI_NodeId GeoId,
@@ -2159,6 +2226,26 @@ FHoudiniEngineUtils::HapiGetNodePath( HAPI_NodeId NodeId, HAPI_NodeId RelativeTo
     return false;
 }
 
+bool
+FHoudiniEngineUtils::HapiGetAbsoluteNodePath( HAPI_NodeId NodeId, FString & OutPath )
+{
+    if ( !FHoudiniEngineUtils::IsHoudiniNodeValid( NodeId ) )
+        return false;
+
+    // A relative node id of -1 gives the absolute path.
+    HAPI_StringHandle StringHandle;
+    if ( FHoudiniApi::GetNodePath(
+        FHoudiniEngine::Get().GetSession(),
+        NodeId, -1, &StringHandle ) == HAPI_RESULT_SUCCESS )
+    {
+        FHoudiniEngineString HoudiniEngineString( StringHandle );
+        if ( HoudiniEngineString.ToFString( OutPath ) )
+            return true;
+    }
+
+    return false;
+}
+
 bool
 FHoudiniEngineUtils::HapiGetObjectInfos( HAPI_NodeId AssetId, TArray< HAPI_ObjectInfo > & ObjectInfos )
 {
@@ -2628,6 +2715,321 @@ FHoudiniEngineUtils::HapiCreateInputNodeForStaticMesh(
     UStaticMeshComponent* StaticMeshComponent /* = nullptr */,
     const bool& ExportAllLODs /* = false */,
     const bool& ExportSockets /* = false */)
+{
+    // If we don't have a static mesh there's nothing to do.
+    if ( !StaticMesh )
+        return false;
+
+    // Fresh inputs of meshes without per component data share a single upload of the mesh.
+    if ( ConnectedAssetId < 0 && FHoudiniEngineUtils::CanShareStaticMeshInput( StaticMesh, StaticMeshComponent, ExportAllLODs ) )
+    {
+        return FHoudiniEngineUtils::HapiCreateInputNodeForSharedStaticMesh(
+            StaticMesh, ConnectedAssetId, OutCreatedNodeIds, ExportAllLODs, ExportSockets );
+    }
+
+    return FHoudiniEngineUtils::HapiCreateInputNodeForStaticMeshData(
+        StaticMesh, ConnectedAssetId, OutCreatedNodeIds, StaticMeshComponent, ExportAllLODs, ExportSockets );
+}
+
+bool
+FHoudiniEngineUtils::CanShareStaticMeshInput(
+    UStaticMesh * StaticMesh, UStaticMeshComponent * StaticMeshComponent, const bool& ExportAllLODs )
+{
+    if ( !StaticMesh )
+        return false;
+
+    if ( !StaticMeshComponent )
+        return true;
+
+    // Attribute data is uploaded from the component's owner.
+    AActor * Owner = StaticMeshComponent->GetOwner();
+    if ( Owner && Owner->FindComponentByClass< UHoudiniAttributeDataComponent >() )
+        return false;
+
+    // So are painted vertex colors.
+    int32 NumLODsToExport = ( ExportAllLODs && StaticMesh->GetNumLODs() > 1 ) ? StaticMesh->GetNumLODs() : 1;
+    for ( int32 LODIndex = 0; LODIndex < NumLODsToExport; LODIndex++ )
+    {
+        if ( StaticMeshComponent->LODData.IsValidIndex( LODIndex ) && StaticMeshComponent->LODData[ LODIndex ].OverrideVertexColors )
+            return false;
+    }
+
+    return true;
+}
+
+uint64
+FHoudiniEngineUtils::ComputeStaticMeshInputHash(
+    UStaticMesh * StaticMesh, const bool& ExportAllLODs, const bool& ExportSockets )
+{
+    uint64 Hash = 0;
+    if ( !StaticMesh )
+        return Hash;
+
+    auto HashBytes = [ &Hash ]( const void * Data, int32 Size )
+    {
+        Hash = CityHash64WithSeed( (const char *) Data, Size, Hash );
+    };
+
+    auto HashString = [ &HashBytes ]( const FString & String )
+    {
+        HashBytes( *String, String.Len() * sizeof( TCHAR ) );
+    };
+
+    // The import settings change the uploaded data as well.
+    const UHoudiniRuntimeSettings * HoudiniRuntimeSettings = GetDefault< UHoudiniRuntimeSettings >();
+    if ( HoudiniRuntimeSettings )
+    {
+        HashBytes( &HoudiniRuntimeSettings->GeneratedGeometryScaleFactor, sizeof( float ) );
+        HashBytes( &HoudiniRuntimeSettings->ImportAxis, sizeof( HoudiniRuntimeSettings->ImportAxis ) );
+        HashBytes( &HoudiniRuntimeSettings->LightMapResolution, sizeof( int32 ) );
+        HashString( HoudiniRuntimeSettings->MarshallingAttributeMaterial );
+        HashString( HoudiniRuntimeSettings->MarshallingAttributeFaceSmoothingMask );
+        HashString( HoudiniRuntimeSettings->MarshallingAttributeLightmapResolution );
+        HashString( HoudiniRuntimeSettings->MarshallingAttributeInputMeshName );
+        HashString( HoudiniRuntimeSettings->MarshallingAttributeInputSourceFile );
+    }
+
+#if WITH_EDITOR
+
+    // Raw mesh bulk data gets a new id whenever it is saved.
+    int32 NumLODsToExport = ( ExportAllLODs && StaticMesh->GetNumLODs() > 1 ) ? StaticMesh->GetNumLODs() : 1;
+    HashBytes( &NumLODsToExport, sizeof( NumLODsToExport ) );
+    for ( int32 LODIndex = 0; LODIndex < NumLODsToExport && StaticMesh->SourceModels.IsValidIndex( LODIndex ); LODIndex++ )
+    {
+        const FStaticMeshSourceModel & SrcModel = StaticMesh->SourceModels[ LODIndex ];
+        if ( SrcModel.RawMeshBulkData )
+            HashString( SrcModel.RawMeshBulkData->GetIdString() );
+
+        HashBytes( &SrcModel.ScreenSize, sizeof( SrcModel.ScreenSize ) );
+
+        for ( int32 MatIdx = 0; MatIdx < StaticMesh->StaticMaterials.Num(); MatIdx++ )
+        {
+            int32 SectionMatIdx = StaticMesh->SectionInfoMap.Get( LODIndex, MatIdx ).MaterialIndex;
+            HashBytes( &SectionMatIdx, sizeof( SectionMatIdx ) );
+        }
+    }
+
+#endif
+
+    for ( const FStaticMaterial & StaticMaterial : StaticMesh->StaticMaterials )
+        HashString( StaticMaterial.MaterialInterface ? StaticMaterial.MaterialInterface->GetPathName() : FString() );
+
+    HashBytes( &StaticMesh->LightMapResolution, sizeof( StaticMesh->LightMapResolution ) );
+    bool bAutoComputeLODScreenSize = StaticMesh->bAutoComputeLODScreenSize;
+    HashBytes( &bAutoComputeLODScreenSize, sizeof( bAutoComputeLODScreenSize ) );
+
+    if ( ExportSockets )
+    {
+        for ( const UStaticMeshSocket * Socket : StaticMesh->Sockets )
+        {
+            if ( !Socket )
+                continue;
+
+            HashString( Socket->SocketName.ToString() );
+            HashString( Socket->Tag );
+            HashBytes( &Socket->RelativeLocation, sizeof( FVector ) );
+            HashBytes( &Socket->RelativeRotation, sizeof( FRotator ) );
+            HashBytes( &Socket->RelativeScale, sizeof( FVector ) );
+        }
+    }
+
+    return Hash;
+}
+
+bool
+FHoudiniEngineUtils::HapiUploadInChunks(
+    int32 ElementCount, int32 ElementSize, TArray< uint8 > & ScratchMemory,
+    TFunctionRef< void( int32 ChunkStart, int32 ChunkCount, void * OutChunk ) > ConvertChunk,
+    TFunctionRef< bool( const void * Chunk, int32 ChunkStart, int32 ChunkCount ) > UploadChunk )
+{
+    const int32 ChunkSize = HAPI_UNREAL_INPUT_UPLOAD_CHUNK_SIZE;
+    if ( ElementCount <= 0 )
+        return true;
+
+    // The scratch memory only grows, so it can be reused by every attribute of an upload.
+    const int32 ScratchBufferSize = FMath::Min( ChunkSize, ElementCount ) * ElementSize;
+    if ( ScratchMemory.Num() < 2 * ScratchBufferSize )
+        ScratchMemory.SetNumUninitialized( 2 * ScratchBufferSize );
+
+    void * ScratchBuffers[ 2 ] = { ScratchMemory.GetData(), ScratchMemory.GetData() + ScratchBufferSize };
+
+    int32 CurrentBuffer = 0;
+    ConvertChunk( 0, FMath::Min( ChunkSize, ElementCount ), ScratchBuffers[ CurrentBuffer ] );
+
+    for ( int32 ChunkStart = 0; ChunkStart < ElementCount; ChunkStart += ChunkSize )
+    {
+        const int32 ChunkCount = FMath::Min( ChunkSize, ElementCount - ChunkStart );
+        const int32 NextChunkStart = ChunkStart + ChunkCount;
+        void * NextChunk = ScratchBuffers[ 1 - CurrentBuffer ];
+
+        // Convert the next chunk while the current one is sent, the session stays on this thread.
+        TFuture< void > NextChunkConversion;
+        if ( NextChunkStart < ElementCount )
+        {
+            NextChunkConversion = Async< void >( EAsyncExecution::TaskGraph, [&]()
+            {
+                ConvertChunk( NextChunkStart, FMath::Min( ChunkSize, ElementCount - NextChunkStart ), NextChunk );
+            } );
+        }
+
+        const bool bUploaded = UploadChunk( ScratchBuffers[ CurrentBuffer ], ChunkStart, ChunkCount );
+
+        // The scratch buffers are reused, wait for the conversion even if the upload failed.
+        if ( NextChunkConversion.IsValid() )
+            NextChunkConversion.Wait();
+
+        if ( !bUploaded )
+            return false;
+
+        CurrentBuffer = 1 - CurrentBuffer;
+    }
+
+    return true;
+}
+
+bool
+FHoudiniEngineUtils::HapiCreateInputNodeForSharedStaticMesh(
+    UStaticMesh * StaticMesh,
+    HAPI_NodeId & ConnectedAssetId,
+    TArray< HAPI_NodeId >& OutCreatedNodeIds,
+    const bool& ExportAllLODs,
+    const bool& ExportSockets )
+{
+#if WITH_EDITOR
+
+    const FString InputKey = FString::Printf(
+        TEXT( "%s:%d:%d" ), *StaticMesh->GetPathName(), ExportAllLODs ? 1 : 0, ExportSockets ? 1 : 0 );
+    const uint64 ContentHash = FHoudiniEngineUtils::ComputeStaticMeshInputHash( StaticMesh, ExportAllLODs, ExportSockets );
+
+    FHoudiniEngineStaticMeshInput StaticMeshInput;
+    bool bCached = FHoudiniEngine::Get().GetCachedStaticMeshInput( InputKey, StaticMeshInput );
+
+    // Forget the merges of the inputs destroyed since the last use.
+    StaticMeshInput.ObjectMergeNodeIds.RemoveAll( []( HAPI_NodeId MergeNodeId )
+    {
+        return !FHoudiniEngineUtils::IsHoudiniNodeValid( MergeNodeId );
+    } );
+
+    if ( bCached && ( StaticMeshInput.ContentHash != ContentHash || !FHoudiniEngineUtils::IsHoudiniNodeValid( StaticMeshInput.NodeId ) ) )
+    {
+        // The mesh has changed since it was uploaded, destroy the previous upload.
+        HAPI_NodeId ParentId = FHoudiniEngineUtils::HapiGetParentNodeId( StaticMeshInput.NodeId );
+        if ( FHoudiniEngineUtils::IsHoudiniNodeValid( ParentId ) )
+            FHoudiniEngineUtils::DestroyHoudiniAsset( ParentId );
+
+        bCached = false;
+    }
+
+    if ( !bCached )
+    {
+        // Upload the mesh, the created nodes are owned by the cache and not by the input.
+        TArray< HAPI_NodeId > SharedCreatedNodeIds;
+        StaticMeshInput.NodeId = -1;
+        StaticMeshInput.ContentHash = ContentHash;
+        if ( !FHoudiniEngineUtils::HapiCreateInputNodeForStaticMeshData(
+            StaticMesh, StaticMeshInput.NodeId, SharedCreatedNodeIds, nullptr, ExportAllLODs, ExportSockets ) )
+        {
+            for ( HAPI_NodeId CreatedNodeId : SharedCreatedNodeIds )
+                FHoudiniEngineUtils::DestroyHoudiniAsset( CreatedNodeId );
+
+            FHoudiniEngine::Get().RemoveCachedStaticMeshInput( InputKey );
+            return false;
+        }
+    }
+
+    FString SharedNodePath;
+    if ( !FHoudiniEngineUtils::HapiGetAbsoluteNodePath( StaticMeshInput.NodeId, SharedNodePath ) )
+        return false;
+
+    std::string SharedNodePathString = TCHAR_TO_UTF8( *SharedNodePath );
+    auto SetObjectMergePath = [ &SharedNodePathString ]( HAPI_NodeId MergeNodeId )
+    {
+        HAPI_ParmInfo ParmInfo;
+        HAPI_ParmId ObjPathParmId = FHoudiniEngineUtils::HapiFindParameterByNameOrTag( MergeNodeId, "objpath1", ParmInfo );
+        if ( ObjPathParmId == -1 )
+            return false;
+
+        HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::SetParmStringValue(
+            FHoudiniEngine::Get().GetSession(), MergeNodeId,
+            SharedNodePathString.c_str(), ObjPathParmId, 0 ), false );
+        return true;
+    };
+
+    // The inputs merging the previous upload are pointed at the new one, so they keep their geometry.
+    if ( !bCached )
+    {
+        for ( HAPI_NodeId MergeNodeId : StaticMeshInput.ObjectMergeNodeIds )
+            SetObjectMergePath( MergeNodeId );
+    }
+
+    // The input merges the shared upload into its own object, so it can be transformed and destroyed on its own.
+    HAPI_NodeId ObjectMergeNodeId = -1;
+    HAPI_Result Result = HAPI_RESULT_SUCCESS;
+    HOUDINI_CHECK_ERROR( &Result, FHoudiniApi::CreateNode(
+        FHoudiniEngine::Get().GetSession(), -1,
+        "SOP/object_merge", "input", true, &ObjectMergeNodeId ) );
+    if ( Result == HAPI_RESULT_SUCCESS )
+    {
+        OutCreatedNodeIds.AddUnique( FHoudiniEngineUtils::HapiGetParentNodeId( ObjectMergeNodeId ) );
+        StaticMeshInput.ObjectMergeNodeIds.Add( ObjectMergeNodeId );
+    }
+
+    // Remember the upload even if the merge failed, the inputs which were already merging it reference it.
+    FHoudiniEngine::Get().CacheStaticMeshInput( InputKey, StaticMeshInput );
+
+    if ( Result != HAPI_RESULT_SUCCESS || !SetObjectMergePath( ObjectMergeNodeId ) )
+        return false;
+
+    HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::CookNode(
+        FHoudiniEngine::Get().GetSession(), ObjectMergeNodeId, nullptr ), false );
+
+    ConnectedAssetId = ObjectMergeNodeId;
+
+#endif
+
+    return true;
+}
+
+void
+FHoudiniEngineUtils::HapiReleaseUnusedSharedStaticMeshInputs()
+{
+    TArray< FString > InputKeys;
+    FHoudiniEngine::Get().GetCachedStaticMeshInputKeys( InputKeys );
+
+    for ( const FString & InputKey : InputKeys )
+    {
+        FHoudiniEngineStaticMeshInput StaticMeshInput;
+        if ( !FHoudiniEngine::Get().GetCachedStaticMeshInput( InputKey, StaticMeshInput ) )
+            continue;
+
+        StaticMeshInput.ObjectMergeNodeIds.RemoveAll( []( HAPI_NodeId MergeNodeId )
+        {
+            return !FHoudiniEngineUtils::IsHoudiniNodeValid( MergeNodeId );
+        } );
+
+        if ( StaticMeshInput.ObjectMergeNodeIds.Num() > 0 )
+        {
+            FHoudiniEngine::Get().CacheStaticMeshInput( InputKey, StaticMeshInput );
+            continue;
+        }
+
+        // No input merges the mesh anymore, destroy its upload.
+        HAPI_NodeId ParentId = FHoudiniEngineUtils::HapiGetParentNodeId( StaticMeshInput.NodeId );
+        if ( FHoudiniEngineUtils::IsHoudiniNodeValid( ParentId ) )
+            FHoudiniEngineUtils::DestroyHoudiniAsset( ParentId );
+
+        FHoudiniEngine::Get().RemoveCachedStaticMeshInput( InputKey );
+    }
+}
+
+bool
+FHoudiniEngineUtils::HapiCreateInputNodeForStaticMeshData(
+    UStaticMesh * StaticMesh,
+    HAPI_NodeId & ConnectedAssetId,
+    TArray< HAPI_NodeId >& OutCreatedNodeIds,
+    UStaticMeshComponent* StaticMeshComponent,
+    const bool& ExportAllLODs,
+    const bool& ExportSockets )
 {
 #if WITH_EDITOR
 
@@ -2635,6 +3037,9 @@ FHoudiniEngineUtils::HapiCreateInputNodeForStaticMesh(
     if ( !StaticMesh )
         return false;
 
+    // Transient marshalling buffers of this upload.
+    FHoudiniScopedCookArena UploadArena;
+
     // Export sockets if there are some
     bool DoExportSockets = ExportSockets && ( StaticMesh->Sockets.Num() > 0 );
 
@@ -2690,6 +3095,13 @@ FHoudiniEngineUtils::HapiCreateInputNodeForStaticMesh(
         GeneratedLightMapResolution = HoudiniRuntimeSettings->LightMapResolution;
     }
 
+    // Unreal space needs the Y and Z axes swapped and the winding of every triangle reversed.
+    check( ImportAxis == HRSAI_Unreal || ImportAxis == HRSAI_Houdini );
+    const bool bConvertToHoudiniAxis = ImportAxis == HRSAI_Unreal;
+
+    // Attributes are converted and sent in chunks through this memory, so huge meshes are never copied whole.
+    TArray< uint8 > UploadScratchMemory;
+
     int32 NumLODsToExport = DoExportLODs ? StaticMesh->GetNumLODs() : 1;
     for ( int32 LODIndex = 0; LODIndex < NumLODsToExport; LODIndex++ )
     {
@@ -2751,40 +3163,28 @@ FHoudiniEngineUtils::HapiCreateInputNodeForStaticMesh(
             FHoudiniEngine::Get().GetSession(), CurrentLODNodeId, 0,
             HAPI_UNREAL_ATTRIB_POSITION, &AttributeInfoPoint ), false );
 
-        // Extract vertices from static mesh.
-        TArray< float > StaticMeshVertices;
-        StaticMeshVertices.SetNumZeroed( RawMesh.VertexPositions.Num() * 3 );
-        for ( int32 VertexIdx = 0; VertexIdx < RawMesh.VertexPositions.Num(); ++VertexIdx )
-        {
-            // Grab vertex at this index.
-            const FVector & PositionVector = RawMesh.VertexPositions[ VertexIdx ];
-
-            if ( ImportAxis == HRSAI_Unreal )
-            {
-                StaticMeshVertices[ VertexIdx * 3 + 0 ] = PositionVector.X / GeneratedGeometryScaleFactor;
-                StaticMeshVertices[ VertexIdx * 3 + 1 ] = PositionVector.Z / GeneratedGeometryScaleFactor;
-                StaticMeshVertices[ VertexIdx * 3 + 2 ] = PositionVector.Y / GeneratedGeometryScaleFactor;
-            }
-            else if ( ImportAxis == HRSAI_Houdini )
+        // Extract vertices from static mesh and upload them for our attribute.
+        const float PositionScaleFactor = 1.0f / GeneratedGeometryScaleFactor;
+        if ( !FHoudiniEngineUtils::HapiUploadInChunks(
+            RawMesh.VertexPositions.Num(), sizeof( FVector ), UploadScratchMemory,
+            [&]( int32 ChunkStart, int32 ChunkCount, void * OutChunk )
             {
-                StaticMeshVertices[ VertexIdx * 3 + 0 ] = PositionVector.X / GeneratedGeometryScaleFactor;
-                StaticMeshVertices[ VertexIdx * 3 + 1 ] = PositionVector.Y / GeneratedGeometryScaleFactor;
-                StaticMeshVertices[ VertexIdx * 3 + 2 ] = PositionVector.Z / GeneratedGeometryScaleFactor;
-            }
-            else
+                FHoudiniMeshConversionUtils::ExportVectors(
+                    RawMesh.VertexPositions.GetData() + ChunkStart, ChunkCount, PositionScaleFactor,
+                    bConvertToHoudiniAxis, false, (FVector *) OutChunk );
+            },
+            [&]( const void * Chunk, int32 ChunkStart, int32 ChunkCount )
             {
-                // Not valid enum value.
-                check( 0 );
-            }
+                HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::SetAttributeFloatData(
+                    FHoudiniEngine::Get().GetSession(), CurrentLODNodeId,
+                    0, HAPI_UNREAL_ATTRIB_POSITION, &AttributeInfoPoint,
+                    (const float *) Chunk, ChunkStart, ChunkCount ), false );
+                return true;
+            } ) )
+        {
+            return false;
         }
 
-        // Now that we have raw positions, we can upload them for our attribute.
-        HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::SetAttributeFloatData(
-            FHoudiniEngine::Get().GetSession(), CurrentLODNodeId,
-            0, HAPI_UNREAL_ATTRIB_POSITION, &AttributeInfoPoint,
-            StaticMeshVertices.GetData(), 0,
-            AttributeInfoPoint.count ), false );
-
         // See if we have texture coordinates to upload.
         for ( int32 MeshTexCoordIdx = 0; MeshTexCoordIdx < MAX_STATIC_TEXCOORDS; ++MeshTexCoordIdx )
         {
@@ -2793,31 +3193,6 @@ FHoudiniEngineUtils::HapiCreateInputNodeForStaticMesh(
             if ( StaticMeshUVCount > 0 )
             {
                 const TArray< FVector2D > & RawMeshUVs = RawMesh.WedgeTexCoords[ MeshTexCoordIdx ];
-                TArray< FVector > StaticMeshUVs;
-                StaticMeshUVs.Reserve( StaticMeshUVCount );
-
-                // Transfer UV data.
-                for ( int32 UVIdx = 0; UVIdx < StaticMeshUVCount; ++UVIdx )
-                    StaticMeshUVs.Emplace( RawMeshUVs[ UVIdx ].X, 1.0 - RawMeshUVs[ UVIdx ].Y, 0 );
-
-                if ( ImportAxis == HRSAI_Unreal )
-                {
-                    // We need to re-index UVs for wedges we swapped (due to winding differences).
-                    for ( int32 WedgeIdx = 0; WedgeIdx < RawMesh.WedgeIndices.Num(); WedgeIdx += 3 )
-                    {
-                        // We do not touch wedge 0 of this triangle.
-                        StaticMeshUVs.SwapMemory( WedgeIdx + 1, WedgeIdx + 2 );
-                    }
-                }
-                else if ( ImportAxis == HRSAI_Houdini )
-                {
-                    // Do nothing, data is in proper format.
-                }
-                else
-                {
-                    // Not valid enum value.
-                    check( 0 );
-                }
 
                 // Construct attribute name for this index.
                 FString UVAttributeName = HAPI_UNREAL_ATTRIB_UV;
@@ -2839,47 +3214,35 @@ FHoudiniEngineUtils::HapiCreateInputNodeForStaticMesh(
                     FHoudiniEngine::Get().GetSession(), CurrentLODNodeId,
                     0, TCHAR_TO_ANSI(*UVAttributeName), &AttributeInfoVertex ), false );
 
-                HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::SetAttributeFloatData(
-                    FHoudiniEngine::Get().GetSession(),
-                    CurrentLODNodeId, 0, TCHAR_TO_ANSI(*UVAttributeName), &AttributeInfoVertex,
-                    (const float *) StaticMeshUVs.GetData(), 0, AttributeInfoVertex.count ), false );
+                // Transfer UV data, re-indexing UVs for wedges we swapped (due to winding differences).
+                if ( !FHoudiniEngineUtils::HapiUploadInChunks(
+                    StaticMeshUVCount, sizeof( FVector ), UploadScratchMemory,
+                    [&]( int32 ChunkStart, int32 ChunkCount, void * OutChunk )
+                    {
+                        FHoudiniMeshConversionUtils::ExportUVs(
+                            RawMeshUVs.GetData() + ChunkStart, ChunkCount, bConvertToHoudiniAxis, (FVector *) OutChunk );
+                    },
+                    [&]( const void * Chunk, int32 ChunkStart, int32 ChunkCount )
+                    {
+                        HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::SetAttributeFloatData(
+                            FHoudiniEngine::Get().GetSession(),
+                            CurrentLODNodeId, 0, TCHAR_TO_ANSI(*UVAttributeName), &AttributeInfoVertex,
+                            (const float *) Chunk, ChunkStart, ChunkCount ), false );
+                        return true;
+                    } ) )
+                {
+                    return false;
+                }
             }
         }
 
         // See if we have normals to upload.
         if ( RawMesh.WedgeTangentZ.Num() > 0 )
         {
-            TArray< FVector > ChangedNormals( RawMesh.WedgeTangentZ );
-
-            if ( ImportAxis == HRSAI_Unreal )
-            {
-                // We need to re-index normals for wedges we swapped (due to winding differences).
-                for ( int32 WedgeIdx = 0; WedgeIdx < RawMesh.WedgeIndices.Num(); WedgeIdx += 3 )
-                {
-                    FVector TangentZ1 = ChangedNormals[ WedgeIdx + 1 ];
-                FVector TangentZ2 = ChangedNormals[ WedgeIdx + 2 ];
-
-                    ChangedNormals[ WedgeIdx + 1 ] = TangentZ2;
-                    ChangedNormals[ WedgeIdx + 2 ] = TangentZ1;
-                }
-
-                for ( int32 WedgeIdx = 0; WedgeIdx < RawMesh.WedgeIndices.Num(); ++WedgeIdx )
-                    Swap( ChangedNormals[ WedgeIdx ].Y, ChangedNormals[ WedgeIdx ].Z );
-            }
-            else if ( ImportAxis == HRSAI_Houdini )
-            {
-                // Do nothing, data is in proper format.
-            }
-            else
-            {
-                // Not valid enum value.
-                check( 0 );
-            }
-
             // Create attribute for normals.
             HAPI_AttributeInfo AttributeInfoVertex;
             FMemory::Memzero< HAPI_AttributeInfo >( AttributeInfoVertex );
-            AttributeInfoVertex.count = ChangedNormals.Num();
+            AttributeInfoVertex.count = RawMesh.WedgeTangentZ.Num();
             AttributeInfoVertex.tupleSize = 3;
             AttributeInfoVertex.exists = true;
             AttributeInfoVertex.owner = HAPI_ATTROWNER_VERTEX;
@@ -2890,17 +3253,31 @@ FHoudiniEngineUtils::HapiCreateInputNodeForStaticMesh(
                 FHoudiniEngine::Get().GetSession(), CurrentLODNodeId,
                 0, HAPI_UNREAL_ATTRIB_NORMAL, &AttributeInfoVertex ), false );
 
-            HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::SetAttributeFloatData(
-                FHoudiniEngine::Get().GetSession(),
-                CurrentLODNodeId, 0, HAPI_UNREAL_ATTRIB_NORMAL, &AttributeInfoVertex,
-                (const float *) ChangedNormals.GetData(),
-                0, AttributeInfoVertex.count ), false );
+            // We need to re-index normals for wedges we swapped (due to winding differences).
+            if ( !FHoudiniEngineUtils::HapiUploadInChunks(
+                RawMesh.WedgeTangentZ.Num(), sizeof( FVector ), UploadScratchMemory,
+                [&]( int32 ChunkStart, int32 ChunkCount, void * OutChunk )
+                {
+                    FHoudiniMeshConversionUtils::ExportVectors(
+                        RawMesh.WedgeTangentZ.GetData() + ChunkStart, ChunkCount, 1.0f,
+                        bConvertToHoudiniAxis, bConvertToHoudiniAxis, (FVector *) OutChunk );
+                },
+                [&]( const void * Chunk, int32 ChunkStart, int32 ChunkCount )
+                {
+                    HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::SetAttributeFloatData(
+                        FHoudiniEngine::Get().GetSession(),
+                        CurrentLODNodeId, 0, HAPI_UNREAL_ATTRIB_NORMAL, &AttributeInfoVertex,
+                        (const float *) Chunk, ChunkStart, ChunkCount ), false );
+                    return true;
+                } ) )
+            {
+                return false;
+            }
         }
 
         {
             // If we have instance override vertex colors, first propagate them to our copy of 
             // the RawMesh Vert Colors
-            TArray< FLinearColor > ChangedColors;
             if ( StaticMeshComponent &&
                 StaticMeshComponent->LODData.IsValidIndex( LODIndex ) &&
                 StaticMeshComponent->LODData[LODIndex].OverrideVertexColors &&
@@ -2940,39 +3317,11 @@ FHoudiniEngineUtils::HapiCreateInputNodeForStaticMesh(
 
             // See if we have colors to upload.
             if ( RawMesh.WedgeColors.Num() > 0 )
-            {
-                ChangedColors.SetNumUninitialized( RawMesh.WedgeColors.Num() );
-
-                if ( ImportAxis == HRSAI_Unreal )
-                {
-                    // We need to re-index colors for wedges we swapped (due to winding differences).
-                    for ( int32 WedgeIdx = 0; WedgeIdx < RawMesh.WedgeIndices.Num(); WedgeIdx += 3 )
-                    {
-                        ChangedColors[WedgeIdx + 0] = RawMesh.WedgeColors[WedgeIdx + 0].ReinterpretAsLinear();
-                        ChangedColors[WedgeIdx + 1] = RawMesh.WedgeColors[WedgeIdx + 2].ReinterpretAsLinear();
-                        ChangedColors[WedgeIdx + 2] = RawMesh.WedgeColors[WedgeIdx + 1].ReinterpretAsLinear();
-                    }
-                }
-                else if ( ImportAxis == HRSAI_Houdini )
-                {
-                    for ( int32 WedgeIdx = 0; WedgeIdx < RawMesh.WedgeIndices.Num(); ++WedgeIdx )
-                    {
-                        ChangedColors[WedgeIdx] = RawMesh.WedgeColors[WedgeIdx].ReinterpretAsLinear();
-                    }
-                }
-                else
-                {
-                    // Not valid enum value.
-                    check( 0 );
-                }
-            }
-
-            if ( ChangedColors.Num() > 0 )
             {
                 // Create attribute for colors.
                 HAPI_AttributeInfo AttributeInfoVertex;
                 FMemory::Memzero< HAPI_AttributeInfo >( AttributeInfoVertex );
-                AttributeInfoVertex.count = ChangedColors.Num();
+                AttributeInfoVertex.count = RawMesh.WedgeColors.Num();
                 AttributeInfoVertex.tupleSize = 4;
                 AttributeInfoVertex.exists = true;
                 AttributeInfoVertex.owner = HAPI_ATTROWNER_VERTEX;
@@ -2983,50 +3332,62 @@ FHoudiniEngineUtils::HapiCreateInputNodeForStaticMesh(
                     FHoudiniEngine::Get().GetSession(), CurrentLODNodeId,
                     0, HAPI_UNREAL_ATTRIB_COLOR, &AttributeInfoVertex ), false );
 
-                HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::SetAttributeFloatData(
-                    FHoudiniEngine::Get().GetSession(),
-                    CurrentLODNodeId, 0, HAPI_UNREAL_ATTRIB_COLOR, &AttributeInfoVertex,
-                    (const float *)ChangedColors.GetData(), 0, AttributeInfoVertex.count ), false );
+                // We need to re-index colors for wedges we swapped (due to winding differences).
+                if ( !FHoudiniEngineUtils::HapiUploadInChunks(
+                    RawMesh.WedgeColors.Num(), sizeof( FLinearColor ), UploadScratchMemory,
+                    [&]( int32 ChunkStart, int32 ChunkCount, void * OutChunk )
+                    {
+                        FHoudiniMeshConversionUtils::ExportColors(
+                            RawMesh.WedgeColors.GetData() + ChunkStart, ChunkCount,
+                            bConvertToHoudiniAxis, (FLinearColor *) OutChunk );
+                    },
+                    [&]( const void * Chunk, int32 ChunkStart, int32 ChunkCount )
+                    {
+                        HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::SetAttributeFloatData(
+                            FHoudiniEngine::Get().GetSession(),
+                            CurrentLODNodeId, 0, HAPI_UNREAL_ATTRIB_COLOR, &AttributeInfoVertex,
+                            (const float *) Chunk, ChunkStart, ChunkCount ), false );
+                        return true;
+                    } ) )
+                {
+                    return false;
+                }
             }
         }
 
         // Extract indices from static mesh.
         if ( RawMesh.WedgeIndices.Num() > 0 )
         {
-            TArray< int32 > StaticMeshIndices;
-            StaticMeshIndices.SetNumUninitialized( RawMesh.WedgeIndices.Num() );
-
-            if ( ImportAxis == HRSAI_Unreal )
-            {
-                for ( int32 IndexIdx = 0; IndexIdx < RawMesh.WedgeIndices.Num(); IndexIdx += 3 )
+            // Swap indices to fix winding order, we can then set vertex list.
+            if ( !FHoudiniEngineUtils::HapiUploadInChunks(
+                RawMesh.WedgeIndices.Num(), sizeof( int32 ), UploadScratchMemory,
+                [&]( int32 ChunkStart, int32 ChunkCount, void * OutChunk )
                 {
-                    // Swap indices to fix winding order.
-                    StaticMeshIndices[ IndexIdx + 0 ] = RawMesh.WedgeIndices[ IndexIdx + 0 ];
-                    StaticMeshIndices[ IndexIdx + 1 ] = RawMesh.WedgeIndices[ IndexIdx + 2 ];
-                    StaticMeshIndices[ IndexIdx + 2 ] = RawMesh.WedgeIndices[ IndexIdx + 1 ];
-                }
-            }
-            else if ( ImportAxis == HRSAI_Houdini )
-            {
-                StaticMeshIndices = TArray< int32 >( RawMesh.WedgeIndices );
-            }
-            else
+                    FHoudiniMeshConversionUtils::ExportIndices(
+                        RawMesh.WedgeIndices.GetData() + ChunkStart, ChunkCount,
+                        bConvertToHoudiniAxis, (int32 *) OutChunk );
+                },
+                [&]( const void * Chunk, int32 ChunkStart, int32 ChunkCount )
+                {
+                    HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::SetVertexList(
+                        FHoudiniEngine::Get().GetSession(), CurrentLODNodeId,
+                        0, (const int32 *) Chunk, ChunkStart, ChunkCount ), false );
+                    return true;
+                } ) )
             {
-                // Not valid enum value.
-                check( 0 );
+                return false;
             }
 
-            // We can now set vertex list.
-            HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::SetVertexList(
-                FHoudiniEngine::Get().GetSession(), CurrentLODNodeId,
-                0, StaticMeshIndices.GetData(), 0, StaticMeshIndices.Num() ), false );
-
-            // We need to generate array of face counts.
+            // We need to generate array of face counts, all chunks share the same one.
             TArray< int32 > StaticMeshFaceCounts;
-            StaticMeshFaceCounts.Init( 3, Part.faceCount );
-            HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::SetFaceCounts(
-                FHoudiniEngine::Get().GetSession(), CurrentLODNodeId,
-                0, StaticMeshFaceCounts.GetData(), 0, StaticMeshFaceCounts.Num() ), false );
+            StaticMeshFaceCounts.Init( 3, FMath::Min( HAPI_UNREAL_INPUT_UPLOAD_CHUNK_SIZE, Part.faceCount ) );
+            for ( int32 FaceStart = 0; FaceStart < Part.faceCount; FaceStart += StaticMeshFaceCounts.Num() )
+            {
+                HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::SetFaceCounts(
+                    FHoudiniEngine::Get().GetSession(), CurrentLODNodeId,
+                    0, StaticMeshFaceCounts.GetData(), FaceStart,
+                    FMath::Min( StaticMeshFaceCounts.Num(), Part.faceCount - FaceStart ) ), false );
+            }
         }
 
         // Marshall face material indices.
@@ -3655,7 +4016,8 @@ FHoudiniEngineUtils::HapiCreateInputNodeForWorldOutliner(
     TArray< HAPI_NodeId >& OutCreatedNodeIds,
     const float& SplineResolution,
     const bool& ExportAllLODs /* = false */,
-    const bool& ExportSockets /* = false */)
+    const bool& ExportSockets /* = false */,
+    const bool& ExportAsInstances /* = false */)
 {
 #if WITH_EDITOR
     if ( OutlinerMeshArray.Num() <= 0 )
@@ -3680,7 +4042,15 @@ FHoudiniEngineUtils::HapiCreateInputNodeForWorldOutliner(
         auto & OutlinerMesh = OutlinerMeshArray[ InputIdx ];
 
         bool bInputCreated = false;
-        if ( OutlinerMesh.StaticMesh != nullptr )
+        if ( OutlinerMesh.StaticMesh != nullptr && ExportAsInstances
+            && FHoudiniEngineUtils::CanShareStaticMeshInput( OutlinerMesh.StaticMesh, OutlinerMesh.StaticMeshComponent, ExportAllLODs ) )
+        {
+            // Meshes are sent once as instances, after all the other inputs. Meshes with per component data
+            // cannot be shared by instances and get their own input instead.
+            OutlinerMesh.AssetId = -1;
+            continue;
+        }
+        else if ( OutlinerMesh.StaticMesh != nullptr )
         {
             // Creating an Input Node for Mesh Data
             bInputCreated = HapiCreateInputNodeForStaticMesh(
@@ -3732,7 +4102,190 @@ FHoudiniEngineUtils::HapiCreateInputNodeForWorldOutliner(
         HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::SetObjectTransform(
             FHoudiniEngine::Get().GetSession(), ParentId, &HapiTransform ), false );
     }
+
+    if ( ExportAsInstances )
+    {
+        HAPI_NodeId InstancesNodeId = -1;
+        if ( !FHoudiniEngineUtils::HapiCreateInputNodeForOutlinerInstances(
+            OutlinerMeshArray, InstancesNodeId, OutCreatedNodeIds, ExportAllLODs, ExportSockets ) )
+            return false;
+
+        // The point cloud goes after the inputs of the other outliner entries.
+        if ( InstancesNodeId >= 0 )
+        {
+            HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::ConnectNodeInput(
+                FHoudiniEngine::Get().GetSession(), ConnectedAssetId, OutlinerMeshArray.Num(),
+                InstancesNodeId ), false );
+        }
+    }
+#endif
+    return true;
+}
+
+bool
+FHoudiniEngineUtils::HapiCreateInputNodeForOutlinerInstances(
+    const TArray< FHoudiniAssetInputOutlinerMesh > & OutlinerMeshArray,
+    HAPI_NodeId & InstancesNodeId,
+    TArray< HAPI_NodeId >& OutCreatedNodeIds,
+    const bool& ExportAllLODs,
+    const bool& ExportSockets )
+{
+#if WITH_EDITOR
+
+    // Transient marshalling buffers of this upload.
+    FHoudiniScopedCookArena UploadArena;
+
+    // Upload each unique mesh once, the instances refer to the object holding it.
+    TMap< UStaticMesh *, int32 > UniqueMeshIndices;
+    TArray< const char * > UniqueMeshPaths;
+    TArray< const char * > UniqueMeshObjectPaths;
+
+    TArray< int32 > InstanceMeshIndices;
+    TArray< FTransform > InstanceTransforms;
+    InstanceMeshIndices.Reserve( OutlinerMeshArray.Num() );
+    InstanceTransforms.Reserve( OutlinerMeshArray.Num() );
+
+    for ( const FHoudiniAssetInputOutlinerMesh & OutlinerMesh : OutlinerMeshArray )
+    {
+        if ( !OutlinerMesh.StaticMesh )
+            continue;
+
+        // Meshes with per component data have been uploaded with their component instead.
+        if ( !FHoudiniEngineUtils::CanShareStaticMeshInput( OutlinerMesh.StaticMesh, OutlinerMesh.StaticMeshComponent, ExportAllLODs ) )
+            continue;
+
+        int32 * FoundMeshIndex = UniqueMeshIndices.Find( OutlinerMesh.StaticMesh );
+        if ( !FoundMeshIndex )
+        {
+            HAPI_NodeId MeshNodeId = -1;
+            FString MeshObjectPath;
+            if ( !FHoudiniEngineUtils::HapiCreateInputNodeForStaticMesh(
+                    OutlinerMesh.StaticMesh, MeshNodeId, OutCreatedNodeIds, nullptr, ExportAllLODs, ExportSockets )
+                || !FHoudiniEngineUtils::HapiGetAbsoluteNodePath( FHoudiniEngineUtils::HapiGetParentNodeId( MeshNodeId ), MeshObjectPath ) )
+            {
+                HOUDINI_LOG_WARNING( TEXT( "Error creating input for instanced mesh %s" ), *OutlinerMesh.StaticMesh->GetPathName() );
+                UniqueMeshIndices.Add( OutlinerMesh.StaticMesh, INDEX_NONE );
+                continue;
+            }
+
+            FoundMeshIndex = &UniqueMeshIndices.Add( OutlinerMesh.StaticMesh, UniqueMeshPaths.Num() );
+            UniqueMeshPaths.Add( FHoudiniScopedCookArena::AllocateString( OutlinerMesh.StaticMesh->GetPathName() ) );
+            UniqueMeshObjectPaths.Add( FHoudiniScopedCookArena::AllocateString( MeshObjectPath ) );
+        }
+
+        if ( *FoundMeshIndex == INDEX_NONE )
+            continue;
+
+        InstanceMeshIndices.Add( *FoundMeshIndex );
+        InstanceTransforms.Add( OutlinerMesh.ComponentTransform );
+    }
+
+    const int32 InstanceCount = InstanceTransforms.Num();
+    if ( InstanceCount <= 0 )
+        return true;
+
+    // Build the point attributes of all the instances.
+    TArray< float > InstancePositions;
+    TArray< float > InstanceOrients;
+    TArray< float > InstanceScales;
+    TArray< const char * > InstanceMeshPaths;
+    TArray< const char * > InstanceObjectPaths;
+    InstancePositions.SetNumUninitialized( InstanceCount * 3 );
+    InstanceOrients.SetNumUninitialized( InstanceCount * 4 );
+    InstanceScales.SetNumUninitialized( InstanceCount * 3 );
+    InstanceMeshPaths.SetNumUninitialized( InstanceCount );
+    InstanceObjectPaths.SetNumUninitialized( InstanceCount );
+
+    for ( int32 InstanceIdx = 0; InstanceIdx < InstanceCount; ++InstanceIdx )
+    {
+        HAPI_Transform HapiTransform;
+        FHoudiniEngineUtils::TranslateUnrealTransform( InstanceTransforms[ InstanceIdx ], HapiTransform );
+
+        FMemory::Memcpy( &InstancePositions[ InstanceIdx * 3 ], HapiTransform.position, 3 * sizeof( float ) );
+        FMemory::Memcpy( &InstanceOrients[ InstanceIdx * 4 ], HapiTransform.rotationQuaternion, 4 * sizeof( float ) );
+        FMemory::Memcpy( &InstanceScales[ InstanceIdx * 3 ], HapiTransform.scale, 3 * sizeof( float ) );
+
+        InstanceMeshPaths[ InstanceIdx ] = UniqueMeshPaths[ InstanceMeshIndices[ InstanceIdx ] ];
+        InstanceObjectPaths[ InstanceIdx ] = UniqueMeshObjectPaths[ InstanceMeshIndices[ InstanceIdx ] ];
+    }
+
+    // Create the input node holding the point cloud.
+    HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::CreateInputNode(
+        FHoudiniEngine::Get().GetSession(), &InstancesNodeId, "instances" ), false );
+
+    if ( !FHoudiniEngineUtils::IsHoudiniNodeValid( InstancesNodeId ) )
+        return false;
+
+    OutCreatedNodeIds.AddUnique( FHoudiniEngineUtils::HapiGetParentNodeId( InstancesNodeId ) );
+
+    HAPI_PartInfo Part;
+    FMemory::Memzero< HAPI_PartInfo >( Part );
+    Part.id = 0;
+    Part.nameSH = 0;
+    Part.pointCount = InstanceCount;
+    Part.vertexCount = 0;
+    Part.faceCount = 0;
+    Part.type = HAPI_PARTTYPE_MESH;
+
+    HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::SetPartInfo(
+        FHoudiniEngine::Get().GetSession(), InstancesNodeId, 0, &Part ), false );
+
+    auto AddPointAttribute = [ & ]( const char * AttributeName, int32 TupleSize, HAPI_StorageType Storage, HAPI_AttributeInfo & AttributeInfo )
+    {
+        FMemory::Memzero< HAPI_AttributeInfo >( AttributeInfo );
+        AttributeInfo.count = InstanceCount;
+        AttributeInfo.tupleSize = TupleSize;
+        AttributeInfo.exists = true;
+        AttributeInfo.owner = HAPI_ATTROWNER_POINT;
+        AttributeInfo.storage = Storage;
+        AttributeInfo.originalOwner = HAPI_ATTROWNER_INVALID;
+
+        return FHoudiniApi::AddAttribute(
+            FHoudiniEngine::Get().GetSession(), InstancesNodeId, 0, AttributeName, &AttributeInfo );
+    };
+
+    HAPI_AttributeInfo AttributeInfoPos;
+    HOUDINI_CHECK_ERROR_RETURN( AddPointAttribute(
+        HAPI_UNREAL_ATTRIB_POSITION, 3, HAPI_STORAGETYPE_FLOAT, AttributeInfoPos ), false );
+    HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::SetAttributeFloatData(
+        FHoudiniEngine::Get().GetSession(), InstancesNodeId, 0, HAPI_UNREAL_ATTRIB_POSITION,
+        &AttributeInfoPos, InstancePositions.GetData(), 0, InstanceCount ), false );
+
+    HAPI_AttributeInfo AttributeInfoOrient;
+    HOUDINI_CHECK_ERROR_RETURN( AddPointAttribute(
+        HAPI_UNREAL_ATTRIB_ORIENT, 4, HAPI_STORAGETYPE_FLOAT, AttributeInfoOrient ), false );
+    HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::SetAttributeFloatData(
+        FHoudiniEngine::Get().GetSession(), InstancesNodeId, 0, HAPI_UNREAL_ATTRIB_ORIENT,
+        &AttributeInfoOrient, InstanceOrients.GetData(), 0, InstanceCount ), false );
+
+    HAPI_AttributeInfo AttributeInfoScale;
+    HOUDINI_CHECK_ERROR_RETURN( AddPointAttribute(
+        HAPI_UNREAL_ATTRIB_SCALE, 3, HAPI_STORAGETYPE_FLOAT, AttributeInfoScale ), false );
+    HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::SetAttributeFloatData(
+        FHoudiniEngine::Get().GetSession(), InstancesNodeId, 0, HAPI_UNREAL_ATTRIB_SCALE,
+        &AttributeInfoScale, InstanceScales.GetData(), 0, InstanceCount ), false );
+
+    // Unreal mesh of each instance, and the object holding its uploaded geometry.
+    HAPI_AttributeInfo AttributeInfoMesh;
+    HOUDINI_CHECK_ERROR_RETURN( AddPointAttribute(
+        HAPI_UNREAL_ATTRIB_INSTANCE_OVERRIDE, 1, HAPI_STORAGETYPE_STRING, AttributeInfoMesh ), false );
+    HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::SetAttributeStringData(
+        FHoudiniEngine::Get().GetSession(), InstancesNodeId, 0, HAPI_UNREAL_ATTRIB_INSTANCE_OVERRIDE,
+        &AttributeInfoMesh, InstanceMeshPaths.GetData(), 0, InstanceCount ), false );
+
+    HAPI_AttributeInfo AttributeInfoInstance;
+    HOUDINI_CHECK_ERROR_RETURN( AddPointAttribute(
+        HAPI_UNREAL_ATTRIB_INSTANCE, 1, HAPI_STORAGETYPE_STRING, AttributeInfoInstance ), false );
+    HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::SetAttributeStringData(
+        FHoudiniEngine::Get().GetSession(), InstancesNodeId, 0, HAPI_UNREAL_ATTRIB_INSTANCE,
+        &AttributeInfoInstance, InstanceObjectPaths.GetData(), 0, InstanceCount ), false );
+
+    // Commit the geo.
+    HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::CommitGeo(
+        FHoudiniEngine::Get().GetSession(), InstancesNodeId ), false );
+
 #endif
+
     return true;
 }
 
@@ -3870,6 +4423,9 @@ bool FHoudiniEngineUtils::CreateStaticMeshesFromHoudiniAsset(
     if ( !FHoudiniEngineUtils::IsHoudiniNodeValid( AssetId ) || !HoudiniCookParams.HoudiniAsset )
         return false;
 
+    // Transient marshalling buffers of this cook.
+    FHoudiniScopedCookArena CookArena;
+
     // Make sure rendering is done - so we are not changing data being used by collision drawing.
     FlushRenderingCommands();
 
@@ -3877,9 +4433,6 @@ bool FHoudiniEngineUtils::CreateStaticMeshesFromHoudiniAsset(
     const UHoudiniRuntimeSettings * HoudiniRuntimeSettings = GetDefault< UHoudiniRuntimeSettings >();
     check( HoudiniRuntimeSettings );
 
-    float GeneratedGeometryScaleFactor = HAPI_UNREAL_SCALE_FACTOR_POSITION;
-    EHoudiniRuntimeSettingsAxisImport ImportAxis = HRSAI_Unreal;
-
     // Attribute marshalling names.
     std::string MarshallingAttributeNameLightmapResolution = HAPI_UNREAL_ATTRIB_LIGHTMAP_RESOLUTION;
     std::string MarshallingAttributeNameMaterial = HAPI_UNREAL_ATTRIB_MATERIAL;
@@ -3901,9 +4454,6 @@ bool FHoudiniEngineUtils::CreateStaticMeshesFromHoudiniAsset(
 
     if ( HoudiniRuntimeSettings )
     {
-        GeneratedGeometryScaleFactor = HoudiniRuntimeSettings->GeneratedGeometryScaleFactor;
-        ImportAxis = HoudiniRuntimeSettings->ImportAxis;
-
         if ( !HoudiniRuntimeSettings->MarshallingAttributeLightmapResolution.IsEmpty() )
             FHoudiniEngineUtils::ConvertUnrealString(
                 HoudiniRuntimeSettings->MarshallingAttributeLightmapResolution, MarshallingAttributeNameLightmapResolution );
@@ -3982,6 +4532,26 @@ bool FHoudiniEngineUtils::CreateStaticMeshesFromHoudiniAsset(
         HoudiniCookParams.HoudiniCookManager->AddAssignmentMaterial( AssPair.Key, AssPair.Value );
     }
 
+    // Static meshes whose build is deferred until all the objects have been processed.
+    TArray< UStaticMesh * > StaticMeshesToBuild;
+
+    // Geometry hashes of the parts generated by the previous cook, used to skip rebuilding parts whose content is identical.
+    TMap< FHoudiniGeoPartObject, uint64 > PreviousPartGeometryHashes;
+    for ( TMap< FHoudiniGeoPartObject, UStaticMesh * >::TConstIterator Iter( StaticMeshesIn ); Iter; ++Iter )
+    {
+        const FHoudiniGeoPartObject & PreviousGeoPartObject = Iter.Key();
+        if ( PreviousGeoPartObject.GeometryHash == 0 || !Iter.Value() )
+            continue;
+
+        FHoudiniGeoPartObject PartKey(
+            PreviousGeoPartObject.AssetId, PreviousGeoPartObject.ObjectId,
+            PreviousGeoPartObject.GeoId, PreviousGeoPartObject.PartId );
+
+        // All the splits of a part share its hash.
+        uint64 & PreviousHash = PreviousPartGeometryHashes.FindOrAdd( PartKey );
+        PreviousHash = PreviousGeoPartObject.GeometryHash;
+    }
+
     // Iterate through all objects.
     for ( int32 ObjectIdx = 0; ObjectIdx < ObjectInfos.Num(); ++ObjectIdx )
     {
@@ -4312,41 +4882,14 @@ bool FHoudiniEngineUtils::CreateStaticMeshesFromHoudiniAsset(
 
             // Containers used for raw data extraction.
 
-            // Vertex Positions
-            TArray< float > PartPositions;
-            HAPI_AttributeInfo AttribInfoPositions;
-            FMemory::Memzero< HAPI_AttributeInfo >( AttribInfoPositions );
-
-            // Vertex Normals
-            TArray< float > PartNormals;
-            HAPI_AttributeInfo AttribInfoNormals;
-            FMemory::Memzero< HAPI_AttributeInfo >( AttribInfoNormals );
-
-            // Vertex Colors
-            TArray< float > PartColors;
-            HAPI_AttributeInfo AttribInfoColors;
-            FMemory::Memzero< HAPI_AttributeInfo >( AttribInfoColors );
-
-            // Vertex Alpha values
-            TArray< float > PartAlphas;
-            HAPI_AttributeInfo AttribInfoAlpha;
-            FMemory::Memzero< HAPI_AttributeInfo >( AttribInfoAlpha );
-
-            // UVs
-            TArray< TArray< float > > PartUVs;
-            PartUVs.SetNumZeroed( MAX_STATIC_TEXCOORDS );
-            TArray< HAPI_AttributeInfo > AttribInfoUVs;
-            AttribInfoUVs.SetNumZeroed( MAX_STATIC_TEXCOORDS );
+            // Positions, normals, colors, alphas, UVs and face smoothing masks
+            FHoudiniPartMeshAttributes PartAttributes;
+            TArray< FVector > & PartPositions = PartAttributes.Positions;
+            HAPI_AttributeInfo & AttribInfoPositions = PartAttributes.AttribInfoPositions;
 
             // Material Overrides per face
-            TArray< FString > PartFaceMaterialAttributeOverrides;
-            HAPI_AttributeInfo AttribFaceMaterials;
-            FMemory::Memzero< HAPI_AttributeInfo >( AttribFaceMaterials );
-
-            // Face Smoothing masks
-            TArray< int32 > PartFaceSmoothingMasks;
-            HAPI_AttributeInfo AttribInfoFaceSmoothingMasks;
-            FMemory::Memzero< HAPI_AttributeInfo >( AttribInfoFaceSmoothingMasks );
+            TArray< FString > & PartFaceMaterialAttributeOverrides = PartAttributes.FaceMaterialAttributeOverrides;
+            HAPI_AttributeInfo & AttribFaceMaterials = PartAttributes.AttribInfoFaceMaterials;
 
             // Lightmap resolution
             TArray< int32 > PartLightMapResolutions;
@@ -4435,110 +4978,55 @@ bool FHoudiniEngineUtils::CreateStaticMeshesFromHoudiniAsset(
             TMap< FString, int32 > GroupSplitFaceCounts;
             TMap< FString, TArray< int32 > > GroupSplitFaceIndices;
 
-            int32 GroupVertexListCount = 0;
             static const FString RemainingGroupName = TEXT( HAPI_UNREAL_GROUP_GEOMETRY_NOT_COLLISION );
 
             if ( bRequireSplit )
             {
-                // Buffer for all vertex indices used for split groups.
-                // We need this to figure out all vertex indices that are not part of them. 
-                TArray< int32 > AllSplitVertexList;
-                AllSplitVertexList.SetNumZeroed( PartVertexList.Num() );
-
-                // Buffer for all face indices used for split groups.
-                // We need this to figure out all face indices that are not part of them.
-                TArray< int32 > AllSplitFaceIndices;
-                AllSplitFaceIndices.SetNumZeroed( PartFaceMaterialIds.Num() );
-
-                // Some of the groups may contain invalid geometry 
-                // Store them here so we can remove them afterwards
-                TArray< int32 > InvalidGroupNameIndices;
-
-                // Extract the vertices/faces for each of the split groups
-                for ( int32 SplitIdx = 0; SplitIdx < SplitGroupNames.Num(); SplitIdx++ )
+                // Partition the part faces between the split groups, each membership is fetched only once.
+                TArray< TArray< int32 > > SplitGroupVertexLists;
+                TArray< TArray< int32 > > SplitGroupFaceLists;
+                TArray< int32 > RemainingVertexList;
+                TArray< int32 > RemainingFaceList;
+                FHoudiniEngineUtils::HapiPartitionSplitGroups(
+                    GeoInfo.nodeId, PartInfo, PartVertexList, SplitGroupNames,
+                    SplitGroupVertexLists, SplitGroupFaceLists, RemainingVertexList, RemainingFaceList );
+
+                // Store the valid groups and remove the ones without geometry (iterate backwards).
+                for ( int32 SplitIdx = SplitGroupNames.Num() - 1; SplitIdx >= 0; SplitIdx-- )
                 {
-                    FString GroupName = SplitGroupNames[ SplitIdx ];
-
-                    // New vertex list just for this group.
-                    TArray< int32 > GroupVertexList;
-                    TArray< int32 > AllFaceList;
-
-                    // Extract vertex indices for this split.
-                    GroupVertexListCount = FHoudiniEngineUtils::HapiGetVertexListForGroup(
-                        AssetId, ObjectInfo.nodeId, GeoInfo.nodeId, PartInfo.id, GroupName, PartVertexList, GroupVertexList,
-                        AllSplitVertexList, AllFaceList, AllSplitFaceIndices, PartInfo.isInstanced );
-
-                    if ( GroupVertexListCount <= 0 )
+                    const FString & GroupName = SplitGroupNames[ SplitIdx ];
+                    if ( SplitGroupFaceLists[ SplitIdx ].Num() <= 0 )
                     {
-                        // This group doesn't have vertices/faces, mark it as invalid
-                        InvalidGroupNameIndices.Add( SplitIdx );
-
                         // Error getting the vertex list.
                         HOUDINI_LOG_MESSAGE(
                             TEXT( "Creating Static Meshes: Object [%d %s], Geo [%d], Part [%d %s] unable to retrieve vertex list for group %s - skipping." ),
                             ObjectInfo.nodeId, *ObjectName, GeoInfo.nodeId, PartIdx, *PartName, *GroupName );
 
-                        continue;
-                    }
-
-                    // If list is not empty, we store it for this group - this will define new mesh.
-                    GroupSplitFaces.Add( GroupName, GroupVertexList );
-                    GroupSplitFaceCounts.Add( GroupName, GroupVertexListCount );
-                    GroupSplitFaceIndices.Add( GroupName, AllFaceList );
-                }
-
-                if ( InvalidGroupNameIndices.Num() > 0 )
-                {
-                    // Remove all invalid split groups
-                    for (int32 InvalIdx = InvalidGroupNameIndices.Num() - 1; InvalIdx >= 0; InvalIdx--)
-                    {
-                        int32 Index = InvalidGroupNameIndices[ InvalIdx ];
-
-                        if ( SplitGroupNames[Index].StartsWith(LodGroupNamePrefix, ESearchCase::IgnoreCase) )
+                        if ( GroupName.StartsWith( LodGroupNamePrefix, ESearchCase::IgnoreCase ) )
                             NumberOfLODs--;
 
-                        SplitGroupNames.RemoveAt( Index );
+                        SplitGroupNames.RemoveAt( SplitIdx );
 
-                        if (Index <= nLODInsertPos)
+                        if ( SplitIdx <= nLODInsertPos )
                             nLODInsertPos--;
-                    }
-                }
 
-                // We also need to figure out / construct vertex list for everything that's not in a split group
-                TArray< int32 > GroupSplitFacesRemaining;
-                GroupSplitFacesRemaining.Init( -1, PartVertexList.Num() );
-                bool bMainSplitGroup = false;
-                GroupVertexListCount = 0;
-
-                TArray< int32 > GroupSplitFaceIndicesRemaining;
-                for ( int32 SplitVertexIdx = 0; SplitVertexIdx < AllSplitVertexList.Num(); SplitVertexIdx++ )
-                {
-                    if ( AllSplitVertexList[ SplitVertexIdx ] == 0 )
-                    {
-                        // This is unused index, we need to add it to unused vertex list.
-                        GroupSplitFacesRemaining[ SplitVertexIdx ] = PartVertexList[ SplitVertexIdx ];
-                        bMainSplitGroup = true;
-                        GroupVertexListCount++;
+                        continue;
                     }
-                }
 
-                for ( int32 SplitFaceIdx = 0; SplitFaceIdx < AllSplitFaceIndices.Num(); SplitFaceIdx++ )
-                {
-                    if ( AllSplitFaceIndices[ SplitFaceIdx ] == 0 )
-                    {
-                        // This is unused face, we need to add it to unused faces list.
-                        GroupSplitFaceIndicesRemaining.Add( SplitFaceIdx );
-                    }
+                    // If list is not empty, we store it for this group - this will define new mesh.
+                    GroupSplitFaceCounts.Add( GroupName, SplitGroupFaceLists[ SplitIdx ].Num() * 3 );
+                    GroupSplitFaces.Add( GroupName, MoveTemp( SplitGroupVertexLists[ SplitIdx ] ) );
+                    GroupSplitFaceIndices.Add( GroupName, MoveTemp( SplitGroupFaceLists[ SplitIdx ] ) );
                 }
 
                 // We store the remaining geo vertex list as a special name (main geo)
                 // and make sure its treated before the collider meshes
-                if ( bMainSplitGroup )
+                if ( RemainingFaceList.Num() > 0 )
                 {
                     SplitGroupNames.Insert( RemainingGroupName, nLODInsertPos );
-                    GroupSplitFaces.Add( RemainingGroupName, GroupSplitFacesRemaining );
-                    GroupSplitFaceCounts.Add( RemainingGroupName, GroupVertexListCount );
-                    GroupSplitFaceIndices.Add( RemainingGroupName, GroupSplitFaceIndicesRemaining );
+                    GroupSplitFaceCounts.Add( RemainingGroupName, RemainingFaceList.Num() * 3 );
+                    GroupSplitFaces.Add( RemainingGroupName, MoveTemp( RemainingVertexList ) );
+                    GroupSplitFaceIndices.Add( RemainingGroupName, MoveTemp( RemainingFaceList ) );
                 }
             }
             else
@@ -4563,6 +5051,108 @@ bool FHoudiniEngineUtils::CreateStaticMeshesFromHoudiniAsset(
                 AssetId, ObjectInfo.nodeId, GeoInfo.nodeId, PartInfo.id,
                 "lod_screensize", AttribInfoLODScreenSize, LODScreenSizes );
 
+            // Raw meshes for each split group, built in parallel before the split groups are processed.
+            TArray< FRawMesh > SplitGroupRawMeshes;
+            TArray< int32 > SplitGroupLightMapUVChannels;
+            TArray< bool > SplitGroupRawMeshValid;
+            SplitGroupRawMeshes.SetNum( SplitGroupNames.Num() );
+            SplitGroupLightMapUVChannels.SetNumZeroed( SplitGroupNames.Num() );
+            SplitGroupRawMeshValid.SetNumZeroed( SplitGroupNames.Num() );
+
+            // Carry the previous geometry hash over, until we know whether the part content has changed.
+            FHoudiniGeoPartObject PartKey( AssetId, ObjectInfo.nodeId, GeoInfo.nodeId, PartInfo.id );
+            const uint64 * PreviousPartGeometryHash = PreviousPartGeometryHashes.Find( PartKey );
+            HoudiniGeoPartObject.GeometryHash = PreviousPartGeometryHash ? *PreviousPartGeometryHash : 0;
+
+            // Set when HAPI reported a change but the part content is identical to the previous cook.
+            bool bPartGeometryUnchanged = false;
+
+            if ( GeoInfo.hasGeoChanged || ForceRebuildStaticMesh || ForceRecookAll )
+            {
+                // Fetch all the raw attribute buffers for this part from HAPI first. The session is bound
+                // to this thread, so this has to happen here and not from the worker threads.
+                if ( FHoudiniEngineUtils::HapiGetAttributeDataAsFloat(
+                    AssetId, ObjectInfo.nodeId, GeoInfo.nodeId,
+                    PartInfo.id, HAPI_UNREAL_ATTRIB_POSITION, AttribInfoPositions, PartPositions ) )
+                {
+                    // Convert the positions to Unreal's space once, the splits only gather the ones they use.
+                    FHoudiniEngineUtils::ConvertScaleAndFlipVectorData( PartPositions );
+
+                    // No need to read the normals if we'll recompute them after
+                    if ( HoudiniRuntimeSettings->RecomputeNormalsFlag != EHoudiniRuntimeSettingsRecomputeFlag::HRSRF_Always )
+                    {
+                        FHoudiniEngineUtils::HapiGetAttributeDataAsFloat(
+                            AssetId, ObjectInfo.nodeId, GeoInfo.nodeId,
+                            PartInfo.id, HAPI_UNREAL_ATTRIB_NORMAL, PartAttributes.AttribInfoNormals, PartAttributes.Normals, 3 );
+                    }
+
+                    FHoudiniEngineUtils::HapiGetAttributeDataAsFloat(
+                        AssetId, ObjectInfo.nodeId, GeoInfo.nodeId,
+                        PartInfo.id, HAPI_UNREAL_ATTRIB_COLOR, PartAttributes.AttribInfoColors, PartAttributes.Colors );
+
+                    FHoudiniEngineUtils::HapiGetAttributeDataAsFloat(
+                        AssetId, ObjectInfo.nodeId, GeoInfo.nodeId,
+                        PartInfo.id, HAPI_UNREAL_ATTRIB_ALPHA, PartAttributes.AttribInfoAlpha, PartAttributes.Alphas );
+
+                    FHoudiniEngineUtils::HapiGetAttributeDataAsInteger(
+                        AssetId, ObjectInfo.nodeId, GeoInfo.nodeId,
+                        PartInfo.id, MarshallingAttributeNameFaceSmoothingMask.c_str(),
+                        PartAttributes.AttribInfoFaceSmoothingMasks, PartAttributes.FaceSmoothingMasks );
+
+                    FHoudiniEngineUtils::GetAllUVAttributesInfoAndTexCoords(
+                        AssetId, ObjectInfo.nodeId, GeoInfo.nodeId, PartInfo.id,
+                        PartAttributes.AttribInfoUVs, PartAttributes.UVs );
+
+                    FHoudiniEngineUtils::HapiGetAttributeDataAsInteger(
+                        AssetId, ObjectInfo.nodeId, GeoInfo.nodeId,
+                        PartInfo.id, MarshallingAttributeNameLightmapResolution.c_str(),
+                        AttribLightmapResolution, PartLightMapResolutions );
+
+                    // Hash the part content and compare it to the one used to generate the existing meshes.
+                    // Material overrides, LOD screen sizes and uproperties are applied to the meshes as well,
+                    // if their values cannot be retrieved the part is considered unknown and always rebuilt.
+                    uint64 MeshPropertyHash = 0;
+                    if ( FHoudiniEngineUtils::HapiComputePartMeshPropertyHash( GeoInfo.nodeId, PartInfo, MeshPropertyHash ) )
+                    {
+                        HoudiniGeoPartObject.GeometryHash = FHoudiniEngineUtils::ComputePartGeometryHash(
+                            PartAttributes, PartVertexList, PartFaceMaterialIds, PartLightMapResolutions,
+                            SplitGroupNames, GroupSplitFaces, MeshPropertyHash );
+                    }
+                    else
+                    {
+                        HoudiniGeoPartObject.GeometryHash = 0;
+                    }
+
+                    bPartGeometryUnchanged = PreviousPartGeometryHash
+                        && HoudiniGeoPartObject.GeometryHash != 0
+                        && ( *PreviousPartGeometryHash == HoudiniGeoPartObject.GeometryHash );
+
+                    // Invisible UCX colliders only feed the aggregate collision and never need a raw mesh.
+                    TArray< int32 > SplitGroupsToBuild;
+                    for ( int32 SplitId = 0; SplitId < SplitGroupNames.Num() && !bPartGeometryUnchanged; SplitId++ )
+                    {
+                        if ( !SplitGroupNames[ SplitId ].StartsWith( UCXCollisionGroupNamePrefix, ESearchCase::IgnoreCase ) )
+                            SplitGroupsToBuild.Add( SplitId );
+                    }
+
+                    // Then convert each split group's geometry on its own worker thread.
+                    SCOPE_CYCLE_COUNTER( STAT_BuildSplitGroupRawMeshes );
+                    ParallelFor( SplitGroupsToBuild.Num(), [&]( int32 BuildIdx )
+                    {
+                        const int32 SplitId = SplitGroupsToBuild[ BuildIdx ];
+                        const FString & SplitGroupName = SplitGroupNames[ SplitId ];
+
+                        SplitGroupRawMeshValid[ SplitId ] = FHoudiniEngineUtils::BuildRawMeshForSplitGroup(
+                            PartAttributes, GroupSplitFaces[ SplitGroupName ], GroupSplitFaceCounts[ SplitGroupName ],
+                            GroupSplitFaceIndices[ SplitGroupName ].Num(), SplitGroupRawMeshes[ SplitId ],
+                            SplitGroupLightMapUVChannels[ SplitId ] );
+                    } );
+                }
+            }
+
+            // Whether this part has the LODForCollision detail attribute, queried when first needed.
+            TOptional< bool > bHasLODForCollisionAttribute;
+
             // Keep track of the LOD Index
             int32 LodIndex = 0;
             int32 LodSplitId = -1;
@@ -4669,6 +5259,8 @@ bool FHoudiniEngineUtils::CreateStaticMeshesFromHoudiniAsset(
 
                             break;
                         }
+
+                        FHoudiniEngineUtils::ConvertScaleAndFlipVectorData( PartPositions );
                     }
 
                     // Use multiple convex hulls?
@@ -4706,6 +5298,10 @@ bool FHoudiniEngineUtils::CreateStaticMeshesFromHoudiniAsset(
                 if ( GeoInfo.hasGeoChanged || ForceRebuildStaticMesh || ForceRecookAll )
                     bRebuildStaticMesh = true;
 
+                // Unless the content of the part is identical to the one used for the existing mesh.
+                if ( bPartGeometryUnchanged && FoundStaticMesh && *FoundStaticMesh )
+                    bRebuildStaticMesh = false;
+
                 // The geometry has not changed,
                 if ( !bRebuildStaticMesh )
                 {
@@ -4794,428 +5390,55 @@ bool FHoudiniEngineUtils::CreateStaticMeshesFromHoudiniAsset(
 
                 if ( bRebuildStaticMesh )
                 {
-                    //--------------------------------------------------------------------------------------------------------------------- 
-                    // NORMALS
-                    //--------------------------------------------------------------------------------------------------------------------- 
-                    TArray< float > SplitGroupNormals;
-
-                    // No need to read the normals if we'll recompute them after
-                    bool bReadNormals = HoudiniRuntimeSettings->RecomputeNormalsFlag != EHoudiniRuntimeSettingsRecomputeFlag::HRSRF_Always;		   
-                    if ( bReadNormals )
+                    // The raw attributes could not be retrieved for this part.
+                    if ( PartPositions.Num() <= 0 )
                     {
-                        if ( PartNormals.Num() <= 0 )
-                        {
-                            // Retrieve normal data for this part
-                            FHoudiniEngineUtils::HapiGetAttributeDataAsFloat(
-                                AssetId, ObjectInfo.nodeId, GeoInfo.nodeId,
-                                PartInfo.id, HAPI_UNREAL_ATTRIB_NORMAL, AttribInfoNormals, PartNormals );
-                        }
+                        // Error retrieving positions.
+                        HOUDINI_LOG_MESSAGE(
+                            TEXT("Creating Static Meshes: Object [%d %s], Geo [%d], Part [%d %s] unable to retrieve position data ")
+                            TEXT("- skipping."),
+                            ObjectInfo.nodeId, *ObjectName, GeoInfo.nodeId, PartIdx, *PartName);
 
-                        // See if we need to transfer normal point attributes to vertex attributes.
-                        FHoudiniEngineUtils::TransferRegularPointAttributesToVertices(
-                            SplitGroupVertexList, AttribInfoNormals, PartNormals, SplitGroupNormals );
-                    }
+                        if ( bStaticMeshCreated )
+                            StaticMesh->MarkPendingKill();
 
-                    // See if we need to generate tangents, we do this only if normals are present, and if we do not recompute them after
-                    bool bGenerateTangents = ( SplitGroupNormals.Num() > 0 );
-                    if ( bGenerateTangents && ( HoudiniRuntimeSettings->RecomputeTangentsFlag == EHoudiniRuntimeSettingsRecomputeFlag::HRSRF_Always ) )
-                    {
-                        // No need to generate tangents if we'll recompute them after
-                        bGenerateTangents = false;
+                        break;
                     }
 
-                    // Transfer normals.
-                    int32 WedgeNormalCount = SplitGroupNormals.Num() / 3;
-                    RawMesh.WedgeTangentZ.SetNumZeroed( WedgeNormalCount );
-                    for ( int32 WedgeTangentZIdx = 0; WedgeTangentZIdx < WedgeNormalCount; ++WedgeTangentZIdx )
+                    // This mesh contains only degenerate triangles, there's nothing we can do.
+                    if ( !SplitGroupRawMeshValid[ SplitId ] )
                     {
-                        FVector WedgeTangentZ;
-                        WedgeTangentZ.X = SplitGroupNormals[ WedgeTangentZIdx * 3 + 0 ];
-                        if ( ImportAxis == HRSAI_Unreal )
-                        {
-                            // We need to flip Z and Y coordinate
-                            WedgeTangentZ.Y = SplitGroupNormals[ WedgeTangentZIdx * 3 + 2 ];
-                            WedgeTangentZ.Z = SplitGroupNormals[ WedgeTangentZIdx * 3 + 1 ];
-                        }
-                        else
-                        {
-                            WedgeTangentZ.Y = SplitGroupNormals[ WedgeTangentZIdx * 3 + 1 ];
-                            WedgeTangentZ.Z = SplitGroupNormals[ WedgeTangentZIdx * 3 + 2 ];
-                        }
-
-                        RawMesh.WedgeTangentZ[ WedgeTangentZIdx ] = WedgeTangentZ;
-
-                        // If we need to generate tangents.
-                        if ( bGenerateTangents )
-                        {
-                            FVector TangentX, TangentY;
-                            WedgeTangentZ.FindBestAxisVectors( TangentX, TangentY );
+                        if ( bStaticMeshCreated )
+                            StaticMesh->MarkPendingKill();
 
-                            RawMesh.WedgeTangentX.Add( TangentX );
-                            RawMesh.WedgeTangentY.Add( TangentY );
-                        }
+                        continue;
                     }
 
-                    //--------------------------------------------------------------------------------------------------------------------- 
-                    //	VERTEX COLORS AND ALPHAS
-                    //--------------------------------------------------------------------------------------------------------------------- 		                        
-                    TArray< float > SplitGroupColors;
-                    if ( PartColors.Num() <= 0 )
-                    {
-                        // Retrieve color data
-                        FHoudiniEngineUtils::HapiGetAttributeDataAsFloat(
-                            AssetId, ObjectInfo.nodeId, GeoInfo.nodeId,
-                            PartInfo.id, HAPI_UNREAL_ATTRIB_COLOR, AttribInfoColors, PartColors );
-                    }
+                    // Use the raw mesh that was built for this split group.
+                    RawMesh = MoveTemp( SplitGroupRawMeshes[ SplitId ] );
 
-                    // See if we need to transfer color point attributes to vertex attributes.
-                    FHoudiniEngineUtils::TransferRegularPointAttributesToVertices(
-                        SplitGroupVertexList, AttribInfoColors, PartColors, SplitGroupColors );
+                    // Set the lightmap Coordinate Index
+                    // If we have more than one UV set, the 2nd set will be used for lightmaps by convention
+                    // If not, the first UV set will be used
+                    StaticMesh->LightMapCoordinateIndex = SplitGroupLightMapUVChannels[ SplitId ];
+                }
+                else
+                {
+                    // We dont need to rebuild the mesh (because the geometry hasn't changed, but the materials have)
+                    // So we can just load the old data into the Raw mesh and reuse it.
+                    FRawMeshBulkData * InRawMeshBulkData = SrcModel->RawMeshBulkData;
+                    InRawMeshBulkData->LoadRawMesh( RawMesh );
+                }
 
-                    TArray< float > SplitGroupAlphas;
-                    if ( PartAlphas.Num() <= 0 )
-                    {
-                        // Retrieve alpha data
-                        FHoudiniEngineUtils::HapiGetAttributeDataAsFloat(
-                            AssetId, ObjectInfo.nodeId, GeoInfo.nodeId,
-                            PartInfo.id, HAPI_UNREAL_ATTRIB_ALPHA, AttribInfoAlpha, PartAlphas );
-                    }
+                //--------------------------------------------------------------------------------------------------------------------- 
+                // MATERIAL ATTRIBUTE OVERRIDES
+                //---------------------------------------------------------------------------------------------------------------------
 
-                    // See if we need to transfer alpha point attributes to vertex attributes.
-                    FHoudiniEngineUtils::TransferRegularPointAttributesToVertices(
-                        SplitGroupVertexList, AttribInfoAlpha, PartAlphas, SplitGroupAlphas );
+                // See if we have material override attributes, only once per part.
+                if ( !PartAttributes.bFaceMaterialAttributeOverridesFetched )
+                {
+                    PartAttributes.bFaceMaterialAttributeOverridesFetched = true;
 
-                    // Transfer colors and alphas to the raw mesh
-                    if ( AttribInfoColors.exists && ( AttribInfoColors.tupleSize > 0 ) )
-                    {
-                        int32 WedgeColorsCount = SplitGroupColors.Num() / AttribInfoColors.tupleSize;
-                        RawMesh.WedgeColors.SetNumZeroed( WedgeColorsCount );
-                        for ( int32 WedgeColorIdx = 0; WedgeColorIdx < WedgeColorsCount; ++WedgeColorIdx )
-                        {
-                            FLinearColor WedgeColor;
-                            WedgeColor.R = FMath::Clamp(
-                                SplitGroupColors[ WedgeColorIdx * AttribInfoColors.tupleSize + 0 ], 0.0f, 1.0f );
-                            WedgeColor.G = FMath::Clamp(
-                                SplitGroupColors[ WedgeColorIdx * AttribInfoColors.tupleSize + 1 ], 0.0f, 1.0f );
-                            WedgeColor.B = FMath::Clamp(
-                                SplitGroupColors[ WedgeColorIdx * AttribInfoColors.tupleSize + 2 ], 0.0f, 1.0f );
-
-                            if( AttribInfoAlpha.exists )
-                            {
-                                WedgeColor.A = FMath::Clamp( SplitGroupAlphas[ WedgeColorIdx ], 0.0f, 1.0f );
-                            }
-                            else if ( AttribInfoColors.tupleSize == 4 )
-                            {
-                                // We have alpha.
-                                WedgeColor.A = FMath::Clamp(
-                                    SplitGroupColors[ WedgeColorIdx * AttribInfoColors.tupleSize + 3 ], 0.0f, 1.0f );
-                            }
-                            else
-                            {
-                                WedgeColor.A = 1.0f;
-                            }
-
-                            // Convert linear color to fixed color.
-                            RawMesh.WedgeColors[ WedgeColorIdx ] = WedgeColor.ToFColor( false );
-                        }
-                    }
-                    else
-                    {
-                        // No Colors or Alphas, init colors to White
-                        FColor DefaultWedgeColor = FLinearColor::White.ToFColor( false );
-                        int32 WedgeColorsCount = RawMesh.WedgeIndices.Num();
-                        if ( WedgeColorsCount > 0 )
-                            RawMesh.WedgeColors.Init( DefaultWedgeColor, WedgeColorsCount );
-                    }
-
-                    //--------------------------------------------------------------------------------------------------------------------- 
-                    //	FACE SMOOTHING
-                    //--------------------------------------------------------------------------------------------------------------------- 
-
-                    // Retrieve face smoothing data.
-                    if ( PartFaceSmoothingMasks.Num() <= 0 )
-                    {
-                        FHoudiniEngineUtils::HapiGetAttributeDataAsInteger(
-                            AssetId, ObjectInfo.nodeId, GeoInfo.nodeId,
-                            PartInfo.id, MarshallingAttributeNameFaceSmoothingMask.c_str(),
-                            AttribInfoFaceSmoothingMasks, PartFaceSmoothingMasks );
-                    }
-
-                    // Set face smoothing masks.
-                    RawMesh.FaceSmoothingMasks.SetNumZeroed( SplitGroupFaceCount );
-                    if ( PartFaceSmoothingMasks.Num() )
-                    {
-                        int32 ValidFaceIdx = 0;
-                        for ( int32 VertexIdx = 0; VertexIdx < SplitGroupVertexList.Num(); VertexIdx += 3 )
-                        {
-                            int32 WedgeCheck = SplitGroupVertexList[ VertexIdx + 0 ];
-                            if ( WedgeCheck == -1 )
-                                continue;
-
-                            RawMesh.FaceSmoothingMasks[ ValidFaceIdx ] = PartFaceSmoothingMasks[ VertexIdx / 3 ];
-                            ValidFaceIdx++;
-                        }
-                    }
-
-                    //--------------------------------------------------------------------------------------------------------------------- 
-                    //	UVS
-                    //--------------------------------------------------------------------------------------------------------------------- 
-
-                    // Extract all UV sets
-                    TArray< TArray< float > > SplitGroupUVs;
-                    SplitGroupUVs.SetNumZeroed( MAX_STATIC_TEXCOORDS );
-
-                    if ( PartUVs.Num() && PartUVs[0].Num() <= 0 )
-                    {
-                        // Retrieve all the UVs sets for this part
-                        FHoudiniEngineUtils::GetAllUVAttributesInfoAndTexCoords(
-                            AssetId, ObjectInfo.nodeId, GeoInfo.nodeId, PartInfo.id,
-                            AttribInfoUVs, PartUVs );
-                    }
-
-                    // See if we need to transfer uv point attributes to vertex attributes.
-                    for ( int32 TexCoordIdx = 0; TexCoordIdx < MAX_STATIC_TEXCOORDS; ++TexCoordIdx )
-                    {
-                        FHoudiniEngineUtils::TransferRegularPointAttributesToVertices(
-                            SplitGroupVertexList, AttribInfoUVs[ TexCoordIdx ], PartUVs[ TexCoordIdx ], SplitGroupUVs[ TexCoordIdx ] );
-                    }
-
-                    // Transfer UVs to the Raw Mesh
-                    int32 UVChannelCount = 0;
-                    int32 LightMapUVChannel = 0;
-                    for ( int32 TexCoordIdx = 0; TexCoordIdx < MAX_STATIC_TEXCOORDS; ++TexCoordIdx )
-                    {
-                        TArray< float > & TextureCoordinate = SplitGroupUVs[ TexCoordIdx ];
-                        if ( TextureCoordinate.Num() > 0 )
-                        {
-                            int32 WedgeUVCount = TextureCoordinate.Num() / 2;
-                            RawMesh.WedgeTexCoords[ TexCoordIdx ].SetNumZeroed( WedgeUVCount );
-                            for ( int32 WedgeUVIdx = 0; WedgeUVIdx < WedgeUVCount; ++WedgeUVIdx )
-                            {
-                                // We need to flip V coordinate when it's coming from HAPI.
-                                FVector2D WedgeUV;
-                                WedgeUV.X = TextureCoordinate[ WedgeUVIdx * 2 + 0 ];
-                                WedgeUV.Y = 1.0f - TextureCoordinate[ WedgeUVIdx * 2 + 1 ];
-
-                                RawMesh.WedgeTexCoords[ TexCoordIdx ][ WedgeUVIdx ] = WedgeUV;
-                            }
-
-                            UVChannelCount++;
-
-                            if ( UVChannelCount <= 2 )
-                                LightMapUVChannel = TexCoordIdx;
-                        }
-                        else
-                        {
-                            RawMesh.WedgeTexCoords[ TexCoordIdx ].Empty();
-                        }
-                    }
-
-                    // We have to have at least one UV channel. If there's none, create one with zero data.
-                    if ( UVChannelCount == 0 )
-                        RawMesh.WedgeTexCoords[ 0 ].SetNumZeroed( SplitGroupVertexListCount );
-
-                    // Set the lightmap Coordinate Index
-                    // If we have more than one UV set, the 2nd set will be used for lightmaps by convention
-                    // If not, the first UV set will be used
-                    StaticMesh->LightMapCoordinateIndex = LightMapUVChannel;
-
-                    //--------------------------------------------------------------------------------------------------------------------- 
-                    // LIGHTMAP RESOLUTION
-                    //--------------------------------------------------------------------------------------------------------------------- 
-
-                    // Get lightmap resolution (if present).
-                    if ( PartLightMapResolutions.Num() <= 0 )
-                    {
-                        FHoudiniEngineUtils::HapiGetAttributeDataAsInteger(
-                            AssetId, ObjectInfo.nodeId, GeoInfo.nodeId,
-                            PartInfo.id, MarshallingAttributeNameLightmapResolution.c_str(),
-                            AttribLightmapResolution, PartLightMapResolutions );
-                    }
-
-                    //--------------------------------------------------------------------------------------------------------------------- 
-                    //	INDICES
-                    //--------------------------------------------------------------------------------------------------------------------- 
-                    
-                    //
-                    // Because of the splits, we don't need to declare all the vertices in the Part, 
-                    // but only the one that are currently used by the split's faces.
-                    // The indicesMapper array is used to map those indices from Part Vertices to Split Vertices.
-                    // We also keep track of the needed vertices index to declare them easily afterwards.
-                    //
-
-                    // IndicesMapper:
-                    // Maps index values for all vertices in the Part:
-                    // - Vertices unused by the split will be set to -1
-                    // - Used vertices will have their value set to the "NewIndex"
-                    // So that IndicesMapper[ oldIndex ] => newIndex
-                    TArray< int32 > IndicesMapper;
-                    IndicesMapper.Init( -1, SplitGroupVertexList.Num() );
-                    int32 CurrentMapperIndex = 0;
-
-                    // Neededvertices:
-                    // Contains the old index of the needed vertices for the current split
-                    // NeededVertices[ newIndex ] => oldIndex
-                    TArray< int32 > NeededVertices;
-
-                    RawMesh.WedgeIndices.SetNumZeroed( SplitGroupVertexListCount );
-                    int32 ValidVertexId = 0;
-                    for ( int32 VertexIdx = 0; VertexIdx < SplitGroupVertexList.Num(); VertexIdx += 3 )
-                    {
-                        int32 WedgeCheck = SplitGroupVertexList[ VertexIdx + 0 ];
-                        if ( WedgeCheck == -1 )
-                            continue;
-
-                        int32 WedgeIndices[ 3 ] = 
-                        {
-                            SplitGroupVertexList[ VertexIdx + 0 ],
-                            SplitGroupVertexList[ VertexIdx + 1 ],
-                            SplitGroupVertexList[ VertexIdx + 2 ]
-                        };
-
-                        // Converting Old (Part) Indices to New (Split) Indices:
-                        for ( int32 i = 0; i < 3; i++ )
-                        {
-                            if ( IndicesMapper[ WedgeIndices[ i ] ] < 0 )
-                            {
-                                // This old index was not yet "converted" to a new index
-                                NeededVertices.Add( WedgeIndices[ i ] );
-
-                                IndicesMapper[ WedgeIndices[ i ] ] = CurrentMapperIndex;
-                                CurrentMapperIndex++;
-                            }
-                               
-                            // Replace the old index with the new one
-                            WedgeIndices[ i ] = IndicesMapper[ WedgeIndices[ i ] ];
-                        }
-
-                        if ( ValidVertexId >= SplitGroupVertexListCount )
-                            continue;
-
-                        if ( ImportAxis == HRSAI_Unreal )
-                        {
-                            // Flip wedge indices to fix the winding order.
-                            RawMesh.WedgeIndices[ ValidVertexId + 0 ] = WedgeIndices[ 0 ];
-                            RawMesh.WedgeIndices[ ValidVertexId + 1 ] = WedgeIndices[ 2 ];
-                            RawMesh.WedgeIndices[ ValidVertexId + 2 ] = WedgeIndices[ 1 ];
-
-                            // Check if we need to patch UVs.
-                            for ( int32 TexCoordIdx = 0; TexCoordIdx < MAX_STATIC_TEXCOORDS; ++TexCoordIdx )
-                            {
-                                if ( RawMesh.WedgeTexCoords[ TexCoordIdx ].Num() > 0
-                                    && ( (ValidVertexId + 2) < RawMesh.WedgeTexCoords[ TexCoordIdx ].Num() ) )
-                                {
-                                    Swap( RawMesh.WedgeTexCoords[ TexCoordIdx ][ ValidVertexId + 1 ],
-                                        RawMesh.WedgeTexCoords[ TexCoordIdx ][ ValidVertexId + 2 ] );
-                                }
-                            }
-
-                            // Check if we need to patch colors.
-                            if ( RawMesh.WedgeColors.Num() > 0 )
-                                Swap( RawMesh.WedgeColors[ ValidVertexId + 1 ], RawMesh.WedgeColors[ ValidVertexId + 2 ] );
-
-                            // Check if we need to patch Normals and tangents.
-                            if ( RawMesh.WedgeTangentZ.Num() > 0 )
-                                Swap( RawMesh.WedgeTangentZ[ ValidVertexId + 1 ], RawMesh.WedgeTangentZ[ ValidVertexId + 2 ] );
-
-                            if ( RawMesh.WedgeTangentX.Num() > 0 )
-                                Swap( RawMesh.WedgeTangentX[ ValidVertexId + 1 ], RawMesh.WedgeTangentX[ ValidVertexId + 2 ] );
-
-                            if ( RawMesh.WedgeTangentY.Num() > 0 )
-                                Swap ( RawMesh.WedgeTangentY[ ValidVertexId + 1 ], RawMesh.WedgeTangentY[ ValidVertexId + 2 ] );
-                        }
-                        else if ( ImportAxis == HRSAI_Houdini )
-                        {
-                            // Dont flip the wedge indices
-                            RawMesh.WedgeIndices[ ValidVertexId + 0 ] = WedgeIndices[ 0 ];
-                            RawMesh.WedgeIndices[ ValidVertexId + 1 ] = WedgeIndices[ 1 ];
-                            RawMesh.WedgeIndices[ ValidVertexId + 2 ] = WedgeIndices[ 2 ];
-                        }
-
-                        ValidVertexId += 3;
-                    }
-
-                    //--------------------------------------------------------------------------------------------------------------------- 
-                    // POSITIONS
-                    //--------------------------------------------------------------------------------------------------------------------- 
-
-                    // We may already have gotten the positions when creating the ucx collisions
-                    if ( PartPositions.Num() <= 0 )
-                    {
-                        // Retrieve position data.
-                        if ( !FHoudiniEngineUtils::HapiGetAttributeDataAsFloat(
-                            AssetId, ObjectInfo.nodeId, GeoInfo.nodeId,
-                            PartInfo.id, HAPI_UNREAL_ATTRIB_POSITION, AttribInfoPositions, PartPositions ) )
-                        {
-                            // Error retrieving positions.
-                            HOUDINI_LOG_MESSAGE(
-                                TEXT("Creating Static Meshes: Object [%d %s], Geo [%d], Part [%d %s] unable to retrieve position data ")
-                                TEXT("- skipping."),
-                                ObjectInfo.nodeId, *ObjectName, GeoInfo.nodeId, PartIdx, *PartName);
-
-                            if ( bStaticMeshCreated )
-                                StaticMesh->MarkPendingKill();
-
-                            break;
-                        }
-                    }
-
-                    //
-                    // Transfer vertex positions:
-                    //
-                    // Because of the split, we're only interested in the needed vertices.
-                    // Instead of declaring all the Positions, we'll only declare the vertices
-                    // needed by the current split.
-                    //
-                    int32 VertexPositionsCount = NeededVertices.Num();
-                    RawMesh.VertexPositions.SetNumZeroed( VertexPositionsCount );
-                    for ( int32 VertexPositionIdx = 0; VertexPositionIdx < VertexPositionsCount; ++VertexPositionIdx )
-                    {
-                        int32 NeededVertexIndex = NeededVertices[ VertexPositionIdx ];
-
-                        FVector VertexPosition;
-                        VertexPosition.X = PartPositions[ NeededVertexIndex * 3 + 0 ] * GeneratedGeometryScaleFactor;
-                        if ( ImportAxis == HRSAI_Unreal )
-                        {
-                            // We need to swap Z and Y coordinate here.                            
-                            VertexPosition.Y = PartPositions[ NeededVertexIndex * 3 + 2 ] * GeneratedGeometryScaleFactor;
-                            VertexPosition.Z = PartPositions[ NeededVertexIndex * 3 + 1 ] * GeneratedGeometryScaleFactor;
-                        }
-                        else if ( ImportAxis == HRSAI_Houdini )
-                        {
-                            // No swap required.
-                            VertexPosition.Y = PartPositions[ NeededVertexIndex * 3 + 1 ] * GeneratedGeometryScaleFactor;
-                            VertexPosition.Z = PartPositions[ NeededVertexIndex * 3 + 2 ] * GeneratedGeometryScaleFactor;
-                        }
-
-                        RawMesh.VertexPositions[ VertexPositionIdx ] = VertexPosition;
-                    }
-
-                    // We need to check if this mesh contains only degenerate triangles.
-                    if ( FHoudiniEngineUtils::CountDegenerateTriangles( RawMesh ) == SplitGroupFaceCount )
-                    {
-                        // This mesh contains only degenerate triangles, there's nothing we can do.
-                        if ( bStaticMeshCreated )
-                            StaticMesh->MarkPendingKill();
-
-                        continue;
-                    }
-                }
-                else
-                {
-                    // We dont need to rebuild the mesh (because the geometry hasn't changed, but the materials have)
-                    // So we can just load the old data into the Raw mesh and reuse it.
-                    FRawMeshBulkData * InRawMeshBulkData = SrcModel->RawMeshBulkData;
-                    InRawMeshBulkData->LoadRawMesh( RawMesh );
-                }
-
-                //--------------------------------------------------------------------------------------------------------------------- 
-                // MATERIAL ATTRIBUTE OVERRIDES
-                //---------------------------------------------------------------------------------------------------------------------
-
-                // See if we have material override attributes
-                if ( PartFaceMaterialAttributeOverrides.Num() <= 0 )
-                {
                     FHoudiniEngineUtils::HapiGetAttributeDataAsString(
                         AssetId, ObjectInfo.nodeId, GeoInfo.nodeId, PartInfo.id,
                         MarshallingAttributeNameMaterial.c_str(),
@@ -5326,7 +5549,7 @@ bool FHoudiniEngineUtils::CreateStaticMeshesFromHoudiniAsset(
 
                                     // We need to add this material to the map
                                     FString MaterialShopName = HAPI_UNREAL_DEFAULT_MATERIAL_NAME;
-                                    FHoudiniEngineMaterialUtils::GetUniqueMaterialShopName( AssetId, MaterialId, MaterialShopName );
+                                    PartAttributes.GetUniqueMaterialShopName( AssetId, MaterialId, MaterialShopName );
                                     UMaterialInterface * const * FoundMaterial = Materials.Find( MaterialShopName );
                                     if ( FoundMaterial )
                                         MaterialInterface = *FoundMaterial;
@@ -5365,7 +5588,7 @@ bool FHoudiniEngineUtils::CreateStaticMeshesFromHoudiniAsset(
 
                             // Get id of this single material.
                             FString MaterialShopName = HAPI_UNREAL_DEFAULT_MATERIAL_NAME;
-                            FHoudiniEngineMaterialUtils::GetUniqueMaterialShopName( AssetId, PartFaceMaterialIds[ 0 ], MaterialShopName );
+                            PartAttributes.GetUniqueMaterialShopName( AssetId, PartFaceMaterialIds[ 0 ], MaterialShopName );
                             UMaterialInterface * const * FoundMaterial = Materials.Find( MaterialShopName );
 
                             if ( FoundMaterial )
@@ -5415,7 +5638,7 @@ bool FHoudiniEngineUtils::CreateStaticMeshesFromHoudiniAsset(
                                 UMaterialInterface * Material = MaterialDefault;
 
                                 FString MaterialShopName = HAPI_UNREAL_DEFAULT_MATERIAL_NAME;
-                                FHoudiniEngineMaterialUtils::GetUniqueMaterialShopName( AssetId, MaterialId, MaterialShopName );
+                                PartAttributes.GetUniqueMaterialShopName( AssetId, MaterialId, MaterialShopName );
                                 UMaterialInterface * const * FoundMaterial = Materials.Find( MaterialShopName );
                                 if ( FoundMaterial )
                                     Material = *FoundMaterial;
@@ -5627,7 +5850,10 @@ bool FHoudiniEngineUtils::CreateStaticMeshesFromHoudiniAsset(
                     {
                         // We dont have collider meshes, or simple colliders, if the LODForCollision uproperty attribute is set
                         // we need to activate complex collision for that lod to be picked up as collider
-                        if ( HapiCheckAttributeExists( HoudiniGeoPartObject, "unreal_uproperty_LODForCollision", HAPI_ATTROWNER_DETAIL ) )
+                        if ( !bHasLODForCollisionAttribute.IsSet() )
+                            bHasLODForCollisionAttribute = HapiCheckAttributeExists( HoudiniGeoPartObject, "unreal_uproperty_LODForCollision", HAPI_ATTROWNER_DETAIL );
+
+                        if ( bHasLODForCollisionAttribute.GetValue() )
                             BodySetup->CollisionTraceFlag = ECollisionTraceFlag::CTF_UseComplexAsSimple;
                     }
                 }
@@ -5638,19 +5864,28 @@ bool FHoudiniEngineUtils::CreateStaticMeshesFromHoudiniAsset(
                 // Free any RHI resources.
                 StaticMesh->PreEditChange( nullptr );
 
-                FHoudiniScopedGlobalSilence ScopedGlobalSilence;
-                TArray< FText > BuildErrors;
+                if ( HoudiniGeoPartObject.bIsSimpleCollisionGeo )
                 {
-                    SCOPE_CYCLE_COUNTER( STAT_BuildStaticMesh );
-                    StaticMesh->Build( true, &BuildErrors );
+                    // Simple colliders are fitted to the built render data, so they cannot wait for the batch.
+                    FHoudiniScopedGlobalSilence ScopedGlobalSilence;
+                    TArray< FText > BuildErrors;
+                    {
+                        SCOPE_CYCLE_COUNTER( STAT_BuildStaticMesh );
+                        StaticMesh->Build( true, &BuildErrors );
+                    }
+                    for ( int32 BuildErrorIdx = 0; BuildErrorIdx < BuildErrors.Num(); ++BuildErrorIdx )
+                    {
+                        const FText & TextError = BuildErrors[ BuildErrorIdx ];
+                        HOUDINI_LOG_MESSAGE(
+                            TEXT( "Creating Static Meshes: Object [%d %s], Geo [%d], Part [%d %s], Split [%d] build error " )
+                            TEXT( "- %s." ),
+                            ObjectInfo.nodeId, *ObjectName, GeoInfo.nodeId, PartIdx, *PartName, SplitId, *( TextError.ToString() ) );
+                    }
                 }
-                for ( int32 BuildErrorIdx = 0; BuildErrorIdx < BuildErrors.Num(); ++BuildErrorIdx )
+                else
                 {
-                    const FText & TextError = BuildErrors[ BuildErrorIdx ];
-                    HOUDINI_LOG_MESSAGE(
-                        TEXT( "Creating Static Meshes: Object [%d %s], Geo [%d], Part [%d %s], Split [%d] build error " )
-                        TEXT( "- %s." ),
-                        ObjectInfo.nodeId, *ObjectName, GeoInfo.nodeId, PartIdx, *PartName, SplitId, *( TextError.ToString() ) );
+                    // Other meshes are built all at once after the cook.
+                    StaticMeshesToBuild.AddUnique( StaticMesh );
                 }
 
                 // Do we need to add simple collisions ?
@@ -5746,6 +5981,9 @@ bool FHoudiniEngineUtils::CreateStaticMeshesFromHoudiniAsset(
 
     } // end for ObjectId
 
+    // Build all the meshes generated by this cook in a single batch.
+    FHoudiniEngineUtils::BuildStaticMeshes( StaticMeshesToBuild );
+
     // Now that all the meshes are built and their collisions meshes and primitives updated,
     // we need to update their pre-built navigation collision used by the navmesh
     for ( TMap< FHoudiniGeoPartObject, UStaticMesh * >::TIterator Iter( StaticMeshesOut ); Iter; ++Iter )
@@ -5759,62 +5997,624 @@ bool FHoudiniEngineUtils::CreateStaticMeshesFromHoudiniAsset(
             if ( !StaticMesh )
                 continue;
 
-            if( UBodySetup * BodySetup = StaticMesh->BodySetup )
-            {
-                // Unreal caches the Navigation Collision and never updates it for StaticMeshes,
-                // so we need to manually flush and recreate the data to have proper navigation collision
-                if( StaticMesh->NavCollision )
+            if( UBodySetup * BodySetup = StaticMesh->BodySetup )
+            {
+                // Unreal caches the Navigation Collision and never updates it for StaticMeshes,
+                // so we need to manually flush and recreate the data to have proper navigation collision
+                if( StaticMesh->NavCollision )
+                {
+                    StaticMesh->NavCollision->CookedFormatData.FlushData();
+                    StaticMesh->NavCollision->GatherCollision();
+                    StaticMesh->NavCollision->Setup( BodySetup );
+                }
+            }
+        }
+    }
+
+#endif
+
+    return true;
+}
+
+#if WITH_EDITOR
+
+bool
+FHoudiniEngineUtils::ContainsDegenerateTriangles( const FRawMesh & RawMesh )
+{
+    int32 WedgeCount = RawMesh.WedgeIndices.Num();
+    for ( int32 WedgeIdx = 0; WedgeIdx < WedgeCount; WedgeIdx += 3 )
+    {
+        const FVector & Vertex0 = RawMesh.VertexPositions[ RawMesh.WedgeIndices[ WedgeIdx + 0 ] ];
+        const FVector & Vertex1 = RawMesh.VertexPositions[ RawMesh.WedgeIndices[ WedgeIdx + 1 ] ];
+        const FVector & Vertex2 = RawMesh.VertexPositions[ RawMesh.WedgeIndices[ WedgeIdx + 2 ] ];
+
+        // Strict equality will not detect properly all the degenerated triangles, we need to use Equals here
+        if ( Vertex0.Equals(Vertex1, THRESH_POINTS_ARE_SAME) || Vertex0.Equals(Vertex2, THRESH_POINTS_ARE_SAME) || Vertex1.Equals(Vertex2, THRESH_POINTS_ARE_SAME) )
+            return true;
+    }
+
+    return false;
+}
+
+int32
+FHoudiniEngineUtils::CountDegenerateTriangles( const FRawMesh & RawMesh )
+{
+    int32 DegenerateTriangleCount = 0;
+    int32 WedgeCount = RawMesh.WedgeIndices.Num();
+    for ( int32 WedgeIdx = 0; WedgeIdx < WedgeCount; WedgeIdx += 3 )
+    {
+        const FVector & Vertex0 = RawMesh.VertexPositions[ RawMesh.WedgeIndices[ WedgeIdx + 0 ] ];
+        const FVector & Vertex1 = RawMesh.VertexPositions[ RawMesh.WedgeIndices[ WedgeIdx + 1 ] ];
+        const FVector & Vertex2 = RawMesh.VertexPositions[ RawMesh.WedgeIndices[ WedgeIdx + 2 ] ];
+
+        // Strict equality will not detect properly all the degenerated triangles, we need to use Equals here
+        if( Vertex0.Equals(Vertex1, THRESH_POINTS_ARE_SAME) || Vertex0.Equals(Vertex2, THRESH_POINTS_ARE_SAME) || Vertex1.Equals(Vertex2, THRESH_POINTS_ARE_SAME) )
+            DegenerateTriangleCount++;
+    }
+
+    return DegenerateTriangleCount;
+}
+
+FHoudiniPartMeshAttributes::FHoudiniPartMeshAttributes()
+    : bFaceMaterialAttributeOverridesFetched( false )
+{
+    FMemory::Memzero< HAPI_AttributeInfo >( AttribInfoPositions );
+    FMemory::Memzero< HAPI_AttributeInfo >( AttribInfoNormals );
+    FMemory::Memzero< HAPI_AttributeInfo >( AttribInfoColors );
+    FMemory::Memzero< HAPI_AttributeInfo >( AttribInfoAlpha );
+    FMemory::Memzero< HAPI_AttributeInfo >( AttribInfoFaceSmoothingMasks );
+    FMemory::Memzero< HAPI_AttributeInfo >( AttribInfoFaceMaterials );
+
+    UVs.SetNumZeroed( MAX_STATIC_TEXCOORDS );
+    AttribInfoUVs.SetNumZeroed( MAX_STATIC_TEXCOORDS );
+}
+
+bool
+FHoudiniPartMeshAttributes::GetUniqueMaterialShopName( HAPI_NodeId AssetId, HAPI_NodeId MaterialId, FString & Name )
+{
+    const FString * FoundShopName = MaterialShopNames.Find( MaterialId );
+    if ( FoundShopName )
+    {
+        Name = *FoundShopName;
+        return true;
+    }
+
+    if ( !FHoudiniEngineMaterialUtils::GetUniqueMaterialShopName( AssetId, MaterialId, Name ) )
+        return false;
+
+    MaterialShopNames.Add( MaterialId, Name );
+    return true;
+}
+
+bool
+FHoudiniEngineUtils::BuildRawMeshForSplitGroup(
+    const FHoudiniPartMeshAttributes & PartAttributes, const TArray< int32 > & SplitGroupVertexList,
+    int32 SplitGroupVertexListCount, int32 SplitGroupFaceCount, FRawMesh & RawMesh, int32 & LightMapUVChannel )
+{
+    const UHoudiniRuntimeSettings * HoudiniRuntimeSettings = GetDefault< UHoudiniRuntimeSettings >();
+
+    EHoudiniRuntimeSettingsAxisImport ImportAxis = HRSAI_Unreal;
+    bool bRecomputeTangents = false;
+    if ( HoudiniRuntimeSettings )
+    {
+        ImportAxis = HoudiniRuntimeSettings->ImportAxis;
+        bRecomputeTangents = HoudiniRuntimeSettings->RecomputeTangentsFlag == EHoudiniRuntimeSettingsRecomputeFlag::HRSRF_Always;
+    }
+
+    const TArray< FVector > & PartPositions = PartAttributes.Positions;
+    const TArray< float > & PartNormals = PartAttributes.Normals;
+    const HAPI_AttributeInfo & AttribInfoNormals = PartAttributes.AttribInfoNormals;
+    const TArray< float > & PartColors = PartAttributes.Colors;
+    const HAPI_AttributeInfo & AttribInfoColors = PartAttributes.AttribInfoColors;
+    const TArray< float > & PartAlphas = PartAttributes.Alphas;
+    const HAPI_AttributeInfo & AttribInfoAlpha = PartAttributes.AttribInfoAlpha;
+    const TArray< TArray< float > > & PartUVs = PartAttributes.UVs;
+    const TArray< HAPI_AttributeInfo > & AttribInfoUVs = PartAttributes.AttribInfoUVs;
+    const TArray< int32 > & PartFaceSmoothingMasks = PartAttributes.FaceSmoothingMasks;
+
+    //--------------------------------------------------------------------------------------------------------------------- 
+    // NORMALS
+    //--------------------------------------------------------------------------------------------------------------------- 
+    // Normals are not fetched if we'll recompute them after.
+    // See if we need to transfer normal point attributes to vertex attributes, straight into the raw mesh.
+    int32 WedgeNormalCount = 0;
+    if ( AttribInfoNormals.exists && AttribInfoNormals.tupleSize == 3 )
+    {
+        RawMesh.WedgeTangentZ.SetNumUninitialized( SplitGroupVertexListCount );
+        WedgeNormalCount = FHoudiniEngineUtils::TransferRegularPointAttributesToVertices(
+            SplitGroupVertexList, AttribInfoNormals, PartNormals,
+            (float *) RawMesh.WedgeTangentZ.GetData(), SplitGroupVertexListCount );
+    }
+
+    // Transfer normals, we need to flip Z and Y coordinate when importing to Unreal's axis.
+    RawMesh.WedgeTangentZ.SetNum( WedgeNormalCount, false );
+    FHoudiniMeshConversionUtils::ConvertVectors(
+        (const float *) RawMesh.WedgeTangentZ.GetData(), WedgeNormalCount, 1.0f,
+        ImportAxis == HRSAI_Unreal, RawMesh.WedgeTangentZ.GetData() );
+
+    // See if we need to generate tangents, we do this only if normals are present, and if we do not recompute them after
+    bool bGenerateTangents = ( WedgeNormalCount > 0 );
+    if ( bGenerateTangents && bRecomputeTangents )
+    {
+        // No need to generate tangents if we'll recompute them after
+        bGenerateTangents = false;
+    }
+
+    // If we need to generate tangents.
+    if ( bGenerateTangents )
+    {
+        RawMesh.WedgeTangentX.SetNumUninitialized( WedgeNormalCount );
+        RawMesh.WedgeTangentY.SetNumUninitialized( WedgeNormalCount );
+        for ( int32 WedgeTangentZIdx = 0; WedgeTangentZIdx < WedgeNormalCount; ++WedgeTangentZIdx )
+        {
+            RawMesh.WedgeTangentZ[ WedgeTangentZIdx ].FindBestAxisVectors(
+                RawMesh.WedgeTangentX[ WedgeTangentZIdx ], RawMesh.WedgeTangentY[ WedgeTangentZIdx ] );
+        }
+    }
+
+    //--------------------------------------------------------------------------------------------------------------------- 
+    //	VERTEX COLORS AND ALPHAS
+    //--------------------------------------------------------------------------------------------------------------------- 		                        
+    // Colors and alphas have to be packed to FColor, so they go through this worker thread's scratch memory
+    // which is reused by every split group instead of being allocated for each of them.
+    FMemMark ScratchMark( FMemStack::Get() );
+
+    TArray< float, TMemStackAllocator<> > SplitGroupColors;
+    int32 WedgeColorsCount = 0;
+
+    // See if we need to transfer color point attributes to vertex attributes.
+    if ( AttribInfoColors.exists && ( AttribInfoColors.tupleSize > 0 ) )
+    {
+        SplitGroupColors.SetNumUninitialized( SplitGroupVertexListCount * AttribInfoColors.tupleSize );
+        WedgeColorsCount = FHoudiniEngineUtils::TransferRegularPointAttributesToVertices(
+            SplitGroupVertexList, AttribInfoColors, PartColors, SplitGroupColors.GetData(), SplitGroupVertexListCount );
+    }
+
+    TArray< float, TMemStackAllocator<> > SplitGroupAlphas;
+
+    // See if we need to transfer alpha point attributes to vertex attributes.
+    if ( AttribInfoAlpha.exists && ( AttribInfoAlpha.tupleSize > 0 ) )
+    {
+        SplitGroupAlphas.SetNumZeroed( SplitGroupVertexListCount * AttribInfoAlpha.tupleSize );
+        FHoudiniEngineUtils::TransferRegularPointAttributesToVertices(
+            SplitGroupVertexList, AttribInfoAlpha, PartAlphas, SplitGroupAlphas.GetData(), SplitGroupVertexListCount );
+    }
+
+    // Transfer colors and alphas to the raw mesh
+    if ( AttribInfoColors.exists && ( AttribInfoColors.tupleSize > 0 ) )
+    {
+        RawMesh.WedgeColors.SetNumZeroed( WedgeColorsCount );
+        for ( int32 WedgeColorIdx = 0; WedgeColorIdx < WedgeColorsCount; ++WedgeColorIdx )
+        {
+            FLinearColor WedgeColor;
+            WedgeColor.R = FMath::Clamp(
+                SplitGroupColors[ WedgeColorIdx * AttribInfoColors.tupleSize + 0 ], 0.0f, 1.0f );
+            WedgeColor.G = FMath::Clamp(
+                SplitGroupColors[ WedgeColorIdx * AttribInfoColors.tupleSize + 1 ], 0.0f, 1.0f );
+            WedgeColor.B = FMath::Clamp(
+                SplitGroupColors[ WedgeColorIdx * AttribInfoColors.tupleSize + 2 ], 0.0f, 1.0f );
+
+            if( AttribInfoAlpha.exists )
+            {
+                WedgeColor.A = FMath::Clamp( SplitGroupAlphas[ WedgeColorIdx * AttribInfoAlpha.tupleSize ], 0.0f, 1.0f );
+            }
+            else if ( AttribInfoColors.tupleSize == 4 )
+            {
+                // We have alpha.
+                WedgeColor.A = FMath::Clamp(
+                    SplitGroupColors[ WedgeColorIdx * AttribInfoColors.tupleSize + 3 ], 0.0f, 1.0f );
+            }
+            else
+            {
+                WedgeColor.A = 1.0f;
+            }
+
+            // Convert linear color to fixed color.
+            RawMesh.WedgeColors[ WedgeColorIdx ] = WedgeColor.ToFColor( false );
+        }
+    }
+    else
+    {
+        // No Colors or Alphas, init colors to White
+        FColor DefaultWedgeColor = FLinearColor::White.ToFColor( false );
+        WedgeColorsCount = RawMesh.WedgeIndices.Num();
+        if ( WedgeColorsCount > 0 )
+            RawMesh.WedgeColors.Init( DefaultWedgeColor, WedgeColorsCount );
+    }
+
+    //--------------------------------------------------------------------------------------------------------------------- 
+    //	FACE SMOOTHING
+    //--------------------------------------------------------------------------------------------------------------------- 
+
+    // Set face smoothing masks.
+    RawMesh.FaceSmoothingMasks.SetNumZeroed( SplitGroupFaceCount );
+    if ( PartFaceSmoothingMasks.Num() )
+    {
+        int32 ValidFaceIdx = 0;
+        for ( int32 VertexIdx = 0; VertexIdx < SplitGroupVertexList.Num(); VertexIdx += 3 )
+        {
+            int32 WedgeCheck = SplitGroupVertexList[ VertexIdx + 0 ];
+            if ( WedgeCheck == -1 )
+                continue;
+
+            RawMesh.FaceSmoothingMasks[ ValidFaceIdx ] = PartFaceSmoothingMasks[ VertexIdx / 3 ];
+            ValidFaceIdx++;
+        }
+    }
+
+    //--------------------------------------------------------------------------------------------------------------------- 
+    //	UVS
+    //--------------------------------------------------------------------------------------------------------------------- 
+
+    // Transfer UVs to the Raw Mesh
+    int32 UVChannelCount = 0;
+    LightMapUVChannel = 0;
+    for ( int32 TexCoordIdx = 0; TexCoordIdx < MAX_STATIC_TEXCOORDS; ++TexCoordIdx )
+    {
+        // See if we need to transfer uv point attributes to vertex attributes, straight into the raw mesh.
+        TArray< FVector2D > & WedgeTexCoords = RawMesh.WedgeTexCoords[ TexCoordIdx ];
+        int32 WedgeUVCount = 0;
+        if ( AttribInfoUVs[ TexCoordIdx ].exists && AttribInfoUVs[ TexCoordIdx ].tupleSize == 2 )
+        {
+            WedgeTexCoords.SetNumUninitialized( SplitGroupVertexListCount );
+            WedgeUVCount = FHoudiniEngineUtils::TransferRegularPointAttributesToVertices(
+                SplitGroupVertexList, AttribInfoUVs[ TexCoordIdx ], PartUVs[ TexCoordIdx ],
+                (float *) WedgeTexCoords.GetData(), SplitGroupVertexListCount );
+        }
+
+        if ( WedgeUVCount > 0 )
+        {
+            // We need to flip V coordinate when it's coming from HAPI.
+            WedgeTexCoords.SetNum( WedgeUVCount, false );
+            FHoudiniMeshConversionUtils::ConvertUVs(
+                (const float *) WedgeTexCoords.GetData(), WedgeUVCount, WedgeTexCoords.GetData() );
+
+            UVChannelCount++;
+
+            if ( UVChannelCount <= 2 )
+                LightMapUVChannel = TexCoordIdx;
+        }
+        else
+        {
+            RawMesh.WedgeTexCoords[ TexCoordIdx ].Empty();
+        }
+    }
+
+    // We have to have at least one UV channel. If there's none, create one with zero data.
+    if ( UVChannelCount == 0 )
+        RawMesh.WedgeTexCoords[ 0 ].SetNumZeroed( SplitGroupVertexListCount );
+
+    //--------------------------------------------------------------------------------------------------------------------- 
+    //	INDICES
+    //--------------------------------------------------------------------------------------------------------------------- 
+    
+    //
+    // Because of the splits, we don't need to declare all the vertices in the Part, 
+    // but only the one that are currently used by the split's faces.
+    // The indicesMapper array is used to map those indices from Part Vertices to Split Vertices.
+    // We also keep track of the needed vertices index to declare them easily afterwards.
+    //
+
+    // IndicesMapper:
+    // Maps index values for all vertices in the Part:
+    // - Vertices unused by the split will be set to -1
+    // - Used vertices will have their value set to the "NewIndex"
+    // So that IndicesMapper[ oldIndex ] => newIndex
+    TArray< int32 > IndicesMapper;
+    IndicesMapper.Init( -1, SplitGroupVertexList.Num() );
+    int32 CurrentMapperIndex = 0;
+
+    // Neededvertices:
+    // Contains the old index of the needed vertices for the current split
+    // NeededVertices[ newIndex ] => oldIndex
+    TArray< int32 > NeededVertices;
+
+    RawMesh.WedgeIndices.SetNumZeroed( SplitGroupVertexListCount );
+    int32 ValidVertexId = 0;
+    for ( int32 VertexIdx = 0; VertexIdx < SplitGroupVertexList.Num(); VertexIdx += 3 )
+    {
+        int32 WedgeCheck = SplitGroupVertexList[ VertexIdx + 0 ];
+        if ( WedgeCheck == -1 )
+            continue;
+
+        int32 WedgeIndices[ 3 ] = 
+        {
+            SplitGroupVertexList[ VertexIdx + 0 ],
+            SplitGroupVertexList[ VertexIdx + 1 ],
+            SplitGroupVertexList[ VertexIdx + 2 ]
+        };
+
+        // Converting Old (Part) Indices to New (Split) Indices:
+        for ( int32 i = 0; i < 3; i++ )
+        {
+            if ( IndicesMapper[ WedgeIndices[ i ] ] < 0 )
+            {
+                // This old index was not yet "converted" to a new index
+                NeededVertices.Add( WedgeIndices[ i ] );
+
+                IndicesMapper[ WedgeIndices[ i ] ] = CurrentMapperIndex;
+                CurrentMapperIndex++;
+            }
+               
+            // Replace the old index with the new one
+            WedgeIndices[ i ] = IndicesMapper[ WedgeIndices[ i ] ];
+        }
+
+        if ( ValidVertexId >= SplitGroupVertexListCount )
+            continue;
+
+        if ( ImportAxis == HRSAI_Unreal )
+        {
+            // Flip wedge indices to fix the winding order.
+            RawMesh.WedgeIndices[ ValidVertexId + 0 ] = WedgeIndices[ 0 ];
+            RawMesh.WedgeIndices[ ValidVertexId + 1 ] = WedgeIndices[ 2 ];
+            RawMesh.WedgeIndices[ ValidVertexId + 2 ] = WedgeIndices[ 1 ];
+        }
+        else if ( ImportAxis == HRSAI_Houdini )
+        {
+            // Dont flip the wedge indices
+            RawMesh.WedgeIndices[ ValidVertexId + 0 ] = WedgeIndices[ 0 ];
+            RawMesh.WedgeIndices[ ValidVertexId + 1 ] = WedgeIndices[ 1 ];
+            RawMesh.WedgeIndices[ ValidVertexId + 2 ] = WedgeIndices[ 2 ];
+        }
+
+        ValidVertexId += 3;
+    }
+
+    if ( ImportAxis == HRSAI_Unreal )
+    {
+        // Patch the wedge UVs, colors, normals and tangents to match the flipped winding order.
+        for ( int32 TexCoordIdx = 0; TexCoordIdx < MAX_STATIC_TEXCOORDS; ++TexCoordIdx )
+            FHoudiniMeshConversionUtils::SwapTriangleWinding( RawMesh.WedgeTexCoords[ TexCoordIdx ] );
+
+        FHoudiniMeshConversionUtils::SwapTriangleWinding( RawMesh.WedgeColors );
+        FHoudiniMeshConversionUtils::SwapTriangleWinding( RawMesh.WedgeTangentZ );
+        FHoudiniMeshConversionUtils::SwapTriangleWinding( RawMesh.WedgeTangentX );
+        FHoudiniMeshConversionUtils::SwapTriangleWinding( RawMesh.WedgeTangentY );
+    }
+
+    //--------------------------------------------------------------------------------------------------------------------- 
+    // POSITIONS
+    //--------------------------------------------------------------------------------------------------------------------- 
+
+    //
+    // Transfer vertex positions:
+    //
+    // Because of the split, we're only interested in the needed vertices.
+    // Instead of declaring all the Positions, we'll only declare the vertices
+    // needed by the current split. The part positions have already been scaled and swapped once for all splits.
+    //
+    int32 VertexPositionsCount = NeededVertices.Num();
+    RawMesh.VertexPositions.SetNumUninitialized( VertexPositionsCount );
+    for ( int32 VertexPositionIdx = 0; VertexPositionIdx < VertexPositionsCount; ++VertexPositionIdx )
+        RawMesh.VertexPositions[ VertexPositionIdx ] = PartPositions[ NeededVertices[ VertexPositionIdx ] ];
+
+    // We need to check if this mesh contains only degenerate triangles.
+    return FHoudiniEngineUtils::CountDegenerateTriangles( RawMesh ) != SplitGroupFaceCount;
+}
+
+uint64
+FHoudiniEngineUtils::ComputePartGeometryHash(
+    const FHoudiniPartMeshAttributes & PartAttributes, const TArray< int32 > & PartVertexList,
+    const TArray< HAPI_NodeId > & PartFaceMaterialIds, const TArray< int32 > & PartLightMapResolutions,
+    const TArray< FString > & SplitGroupNames, const TMap< FString, TArray< int32 > > & GroupSplitFaces,
+    uint64 MeshPropertyHash )
+{
+    uint64 Hash = MeshPropertyHash;
+    auto HashValue = [ &Hash ]( const auto & Value )
+    {
+        Hash = CityHash64WithSeed( (const char *) &Value, sizeof( Value ), Hash );
+    };
+
+    auto HashArray = [ &Hash ]( const auto & Array )
+    {
+        int32 Num = Array.Num();
+        Hash = CityHash64WithSeed( (const char *) &Num, sizeof( Num ), Hash );
+        if ( Num > 0 )
+            Hash = CityHash64WithSeed( (const char *) Array.GetData(), Array.Num() * Array.GetTypeSize(), Hash );
+    };
+
+    // The import and mesh build settings change the generated meshes as well.
+    const UHoudiniRuntimeSettings * HoudiniRuntimeSettings = GetDefault< UHoudiniRuntimeSettings >();
+    if ( HoudiniRuntimeSettings )
+    {
+        HashValue( HoudiniRuntimeSettings->GeneratedGeometryScaleFactor );
+        HashValue( (int32) HoudiniRuntimeSettings->ImportAxis );
+        HashValue( (int32) HoudiniRuntimeSettings->RecomputeNormalsFlag );
+        HashValue( (int32) HoudiniRuntimeSettings->RecomputeTangentsFlag );
+        HashValue( (int32) HoudiniRuntimeSettings->GenerateLightmapUVsFlag );
+        HashValue( HoudiniRuntimeSettings->bUseMikkTSpace );
+        HashValue( HoudiniRuntimeSettings->bRemoveDegenerates );
+        HashValue( HoudiniRuntimeSettings->bUseFullPrecisionUVs );
+        HashValue( HoudiniRuntimeSettings->LightMapResolution );
+        HashValue( HoudiniRuntimeSettings->LightMapCoordinateIndex );
+        HashValue( HoudiniRuntimeSettings->MinLightmapResolution );
+        HashValue( HoudiniRuntimeSettings->SrcLightmapIndex );
+        HashValue( HoudiniRuntimeSettings->DstLightmapIndex );
+    }
+
+    HashArray( PartVertexList );
+    HashArray( PartAttributes.Positions );
+    HashArray( PartAttributes.Normals );
+    HashArray( PartAttributes.Colors );
+    HashArray( PartAttributes.Alphas );
+    for ( const TArray< float > & PartUVs : PartAttributes.UVs )
+        HashArray( PartUVs );
+    HashArray( PartAttributes.FaceSmoothingMasks );
+    HashArray( PartFaceMaterialIds );
+    HashArray( PartLightMapResolutions );
+
+    // Group memberships decide how the part is split.
+    for ( const FString & SplitGroupName : SplitGroupNames )
+    {
+        HashArray( SplitGroupName.GetCharArray() );
+
+        const TArray< int32 > * SplitGroupVertexList = GroupSplitFaces.Find( SplitGroupName );
+        if ( SplitGroupVertexList )
+            HashArray( *SplitGroupVertexList );
+    }
+
+    // Zero is reserved for unknown geometry.
+    return Hash != 0 ? Hash : 1;
+}
+
+bool
+FHoudiniEngineUtils::HapiComputePartMeshPropertyHash( HAPI_NodeId GeoId, const HAPI_PartInfo & PartInfo, uint64 & Hash )
+{
+    Hash = 0;
+
+    // The material attribute name can be changed in the settings.
+    FString MaterialAttributeName = TEXT( HAPI_UNREAL_ATTRIB_MATERIAL );
+    const UHoudiniRuntimeSettings * HoudiniRuntimeSettings = GetDefault< UHoudiniRuntimeSettings >();
+    if ( HoudiniRuntimeSettings && !HoudiniRuntimeSettings->MarshallingAttributeMaterial.IsEmpty() )
+        MaterialAttributeName = HoudiniRuntimeSettings->MarshallingAttributeMaterial;
+
+    // String handles are only valid for the current cook, so strings are hashed by value.
+    TMap< HAPI_StringHandle, FString > ResolvedStrings;
+
+    for ( int32 AttributeOwner = 0; AttributeOwner < HAPI_ATTROWNER_MAX; ++AttributeOwner )
+    {
+        int32 AttributeCount = PartInfo.attributeCounts[ AttributeOwner ];
+        if ( AttributeCount <= 0 )
+            continue;
+
+        TArray< HAPI_StringHandle > AttributeNameHandles;
+        AttributeNameHandles.SetNumUninitialized( AttributeCount );
+
+        if ( FHoudiniApi::GetAttributeNames(
+            FHoudiniEngine::Get().GetSession(), GeoId, PartInfo.id, (HAPI_AttributeOwner) AttributeOwner,
+            AttributeNameHandles.GetData(), AttributeCount ) != HAPI_RESULT_SUCCESS )
+            return false;
+
+        for ( HAPI_StringHandle AttributeNameHandle : AttributeNameHandles )
+        {
+            FString AttributeName = TEXT( "" );
+            FHoudiniEngineString( AttributeNameHandle ).ToFString( AttributeName );
+
+            if ( !AttributeName.Equals( MaterialAttributeName )
+                && !AttributeName.Equals( TEXT( HAPI_UNREAL_ATTRIB_MATERIAL_FALLBACK ) )
+                && !AttributeName.Equals( TEXT( HAPI_UNREAL_ATTRIB_MATERIAL_INSTANCE ) )
+                && !AttributeName.EndsWith( TEXT( "_screensize" ) )
+                && !AttributeName.StartsWith( TEXT( HAPI_UNREAL_ATTRIB_GENERIC_UPROP_PREFIX ), ESearchCase::IgnoreCase ) )
+                continue;
+
+            std::string AttributeNameRaw = TCHAR_TO_UTF8( *AttributeName );
+            HAPI_AttributeInfo AttributeInfo;
+            FMemory::Memzero< HAPI_AttributeInfo >( AttributeInfo );
+
+            if ( FHoudiniApi::GetAttributeInfo(
+                FHoudiniEngine::Get().GetSession(), GeoId, PartInfo.id, AttributeNameRaw.c_str(),
+                (HAPI_AttributeOwner) AttributeOwner, &AttributeInfo ) != HAPI_RESULT_SUCCESS || !AttributeInfo.exists )
+                return false;
+
+            Hash = CityHash64WithSeed( (const char *) AttributeName.GetCharArray().GetData(),
+                AttributeName.GetCharArray().Num() * sizeof( TCHAR ), Hash );
+            Hash = CityHash64WithSeed( (const char *) &AttributeOwner, sizeof( AttributeOwner ), Hash );
+
+            int32 ValueCount = AttributeInfo.count * AttributeInfo.tupleSize;
+            if ( ValueCount <= 0 )
+                continue;
+
+            switch ( AttributeInfo.storage )
+            {
+                case HAPI_STORAGETYPE_INT:
+                case HAPI_STORAGETYPE_INT64:
+                {
+                    TArray< int32 > Values;
+                    Values.SetNumUninitialized( ValueCount );
+                    if ( FHoudiniApi::GetAttributeIntData(
+                        FHoudiniEngine::Get().GetSession(), GeoId, PartInfo.id, AttributeNameRaw.c_str(),
+                        &AttributeInfo, -1, Values.GetData(), 0, AttributeInfo.count ) != HAPI_RESULT_SUCCESS )
+                        return false;
+
+                    Hash = CityHash64WithSeed( (const char *) Values.GetData(), ValueCount * sizeof( int32 ), Hash );
+                    break;
+                }
+
+                case HAPI_STORAGETYPE_FLOAT:
+                case HAPI_STORAGETYPE_FLOAT64:
+                {
+                    TArray< float > Values;
+                    Values.SetNumUninitialized( ValueCount );
+                    if ( FHoudiniApi::GetAttributeFloatData(
+                        FHoudiniEngine::Get().GetSession(), GeoId, PartInfo.id, AttributeNameRaw.c_str(),
+                        &AttributeInfo, -1, Values.GetData(), 0, AttributeInfo.count ) != HAPI_RESULT_SUCCESS )
+                        return false;
+
+                    Hash = CityHash64WithSeed( (const char *) Values.GetData(), ValueCount * sizeof( float ), Hash );
+                    break;
+                }
+
+                case HAPI_STORAGETYPE_STRING:
+                {
+                    TArray< HAPI_StringHandle > StringHandles;
+                    StringHandles.SetNumUninitialized( ValueCount );
+                    if ( FHoudiniApi::GetAttributeStringData(
+                        FHoudiniEngine::Get().GetSession(), GeoId, PartInfo.id, AttributeNameRaw.c_str(),
+                        &AttributeInfo, StringHandles.GetData(), 0, AttributeInfo.count ) != HAPI_RESULT_SUCCESS )
+                        return false;
+
+                    for ( HAPI_StringHandle StringHandle : StringHandles )
+                    {
+                        FString * ResolvedString = ResolvedStrings.Find( StringHandle );
+                        if ( !ResolvedString )
+                        {
+                            ResolvedString = &ResolvedStrings.Add( StringHandle );
+                            FHoudiniEngineString( StringHandle ).ToFString( *ResolvedString );
+                        }
+
+                        const TArray< TCHAR > & StringChars = ResolvedString->GetCharArray();
+                        int32 StringLength = StringChars.Num();
+                        Hash = CityHash64WithSeed( (const char *) &StringLength, sizeof( StringLength ), Hash );
+                        if ( StringLength > 0 )
+                            Hash = CityHash64WithSeed( (const char *) StringChars.GetData(), StringLength * sizeof( TCHAR ), Hash );
+                    }
+                    break;
+                }
+
+                default:
                 {
-                    StaticMesh->NavCollision->CookedFormatData.FlushData();
-                    StaticMesh->NavCollision->GatherCollision();
-                    StaticMesh->NavCollision->Setup( BodySetup );
+                    // Values we cannot read cannot be compared either.
+                    return false;
                 }
             }
         }
     }
 
-#endif
-
     return true;
 }
 
-#if WITH_EDITOR
-
-bool
-FHoudiniEngineUtils::ContainsDegenerateTriangles( const FRawMesh & RawMesh )
+void
+FHoudiniEngineUtils::BuildStaticMeshes( const TArray< UStaticMesh * > & StaticMeshes )
 {
-    int32 WedgeCount = RawMesh.WedgeIndices.Num();
-    for ( int32 WedgeIdx = 0; WedgeIdx < WedgeCount; WedgeIdx += 3 )
-    {
-        const FVector & Vertex0 = RawMesh.VertexPositions[ RawMesh.WedgeIndices[ WedgeIdx + 0 ] ];
-        const FVector & Vertex1 = RawMesh.VertexPositions[ RawMesh.WedgeIndices[ WedgeIdx + 1 ] ];
-        const FVector & Vertex2 = RawMesh.VertexPositions[ RawMesh.WedgeIndices[ WedgeIdx + 2 ] ];
+    if ( StaticMeshes.Num() <= 0 )
+        return;
 
-        // Strict equality will not detect properly all the degenerated triangles, we need to use Equals here
-        if ( Vertex0.Equals(Vertex1, THRESH_POINTS_ARE_SAME) || Vertex0.Equals(Vertex2, THRESH_POINTS_ARE_SAME) || Vertex1.Equals(Vertex2, THRESH_POINTS_ARE_SAME) )
-            return true;
-    }
+    FScopedSlowTask SlowTask(
+        (float) StaticMeshes.Num(),
+        FText::Format( LOCTEXT( "BuildingStaticMeshes", "Building {0} Houdini static meshes" ), FText::AsNumber( StaticMeshes.Num() ) ) );
+    SlowTask.MakeDialogDelayed( 1.0f );
 
-    return false;
-}
+    FHoudiniScopedGlobalSilence ScopedGlobalSilence;
+    SCOPE_CYCLE_COUNTER( STAT_BuildStaticMesh );
 
-int32
-FHoudiniEngineUtils::CountDegenerateTriangles( const FRawMesh & RawMesh )
-{
-    int32 DegenerateTriangleCount = 0;
-    int32 WedgeCount = RawMesh.WedgeIndices.Num();
-    for ( int32 WedgeIdx = 0; WedgeIdx < WedgeCount; WedgeIdx += 3 )
+    for ( UStaticMesh * StaticMesh : StaticMeshes )
     {
-        const FVector & Vertex0 = RawMesh.VertexPositions[ RawMesh.WedgeIndices[ WedgeIdx + 0 ] ];
-        const FVector & Vertex1 = RawMesh.VertexPositions[ RawMesh.WedgeIndices[ WedgeIdx + 1 ] ];
-        const FVector & Vertex2 = RawMesh.VertexPositions[ RawMesh.WedgeIndices[ WedgeIdx + 2 ] ];
+        SlowTask.EnterProgressFrame();
 
-        // Strict equality will not detect properly all the degenerated triangles, we need to use Equals here
-        if( Vertex0.Equals(Vertex1, THRESH_POINTS_ARE_SAME) || Vertex0.Equals(Vertex2, THRESH_POINTS_ARE_SAME) || Vertex1.Equals(Vertex2, THRESH_POINTS_ARE_SAME) )
-            DegenerateTriangleCount++;
-    }
+        if ( !StaticMesh || StaticMesh->IsPendingKill() )
+            continue;
 
-    return DegenerateTriangleCount;
+        TArray< FText > BuildErrors;
+        StaticMesh->Build( true, &BuildErrors );
+        for ( int32 BuildErrorIdx = 0; BuildErrorIdx < BuildErrors.Num(); ++BuildErrorIdx )
+        {
+            const FText & TextError = BuildErrors[ BuildErrorIdx ];
+            HOUDINI_LOG_MESSAGE(
+                TEXT( "Creating Static Meshes: Static Mesh [%s] build error - %s." ),
+                *StaticMesh->GetName(), *( TextError.ToString() ) );
+        }
+    }
 }
 
 #endif
@@ -5839,14 +6639,29 @@ FHoudiniEngineUtils::TransferRegularPointAttributesToVertices(
     if ( !AttribInfo.exists || AttribInfo.tupleSize <= 0 )
         return 0;
 
-    int32 ValidWedgeCount = 0;
-
-    // Future optimization - see if we can do direct vertex transfer.
     int32 WedgeCount = VertexList.Num();
-    VertexData.SetNumZeroed( WedgeCount * AttribInfo.tupleSize );
+    VertexData.SetNumUninitialized( WedgeCount * AttribInfo.tupleSize );
+
+    int32 ValidWedgeCount = TransferRegularPointAttributesToVertices(
+        VertexList, AttribInfo, Data, VertexData.GetData(), WedgeCount );
+
+    VertexData.SetNum( ValidWedgeCount * AttribInfo.tupleSize, false );
+
+    return ValidWedgeCount;
+}
+
+int32
+FHoudiniEngineUtils::TransferRegularPointAttributesToVertices(
+    const TArray< int32 > & VertexList, const HAPI_AttributeInfo & AttribInfo,
+    const TArray< float > & Data, float * VertexData, int32 MaxWedgeCount )
+{
+    if ( !AttribInfo.exists || AttribInfo.tupleSize <= 0 )
+        return 0;
+
+    const int32 TupleSize = AttribInfo.tupleSize;
+    int32 ValidWedgeCount = 0;
 
-    int32 LastValidWedgeIdx = 0;
-    for ( int32 WedgeIdx = 0; WedgeIdx < WedgeCount; ++WedgeIdx )
+    for ( int32 WedgeIdx = 0; WedgeIdx < VertexList.Num() && ValidWedgeCount < MaxWedgeCount; ++WedgeIdx )
     {
         int32 VertexId = VertexList[ WedgeIdx ];
 
@@ -5856,63 +6671,82 @@ FHoudiniEngineUtils::TransferRegularPointAttributesToVertices(
             continue;
         }
 
-        // Increment wedge count, since this is a valid wedge.
+        // We are re-indexing wedges.
+        float * SaveData = VertexData + ValidWedgeCount * TupleSize;
         ValidWedgeCount++;
 
-        int32 PrimIdx = WedgeIdx / 3;
-        int32 SaveIdx = 0;
-        float Value = 0.0f;
-
-        for ( int32 AttributeIndexIdx = 0; AttributeIndexIdx < AttribInfo.tupleSize; ++AttributeIndexIdx )
+        int32 ElementIdx = 0;
+        switch ( AttribInfo.owner )
         {
-            switch ( AttribInfo.owner )
+            case HAPI_ATTROWNER_POINT:
             {
-                case HAPI_ATTROWNER_POINT:
-                {
-                    Value = Data[ VertexId * AttribInfo.tupleSize + AttributeIndexIdx ];
-                    break;
-                }
-
-                case HAPI_ATTROWNER_PRIM:
-                {
-                    Value = Data[ PrimIdx * AttribInfo.tupleSize + AttributeIndexIdx ];
-                    break;
-                }
+                ElementIdx = VertexId;
+                break;
+            }
 
-                case HAPI_ATTROWNER_DETAIL:
-                {
-                    Value = Data[ AttributeIndexIdx ];
-                    break;
-                }
+            case HAPI_ATTROWNER_PRIM:
+            {
+                ElementIdx = WedgeIdx / 3;
+                break;
+            }
 
-                case HAPI_ATTROWNER_VERTEX:
-                {
-                    Value = Data[ WedgeIdx * AttribInfo.tupleSize + AttributeIndexIdx ];
-                    break;
-                }
+            case HAPI_ATTROWNER_DETAIL:
+            {
+                ElementIdx = 0;
+                break;
+            }
 
-                default:
-                {
-                    check( false );
-                    continue;
-                }
+            case HAPI_ATTROWNER_VERTEX:
+            {
+                ElementIdx = WedgeIdx;
+                break;
             }
 
-            SaveIdx = LastValidWedgeIdx * AttribInfo.tupleSize + AttributeIndexIdx;
-            VertexData[ SaveIdx ] = Value;
+            default:
+            {
+                check( false );
+                FMemory::Memzero( SaveData, TupleSize * sizeof( float ) );
+                continue;
+            }
         }
 
-        // We are re-indexing wedges.
-        LastValidWedgeIdx++;
+        FMemory::Memcpy( SaveData, &Data[ ElementIdx * TupleSize ], TupleSize * sizeof( float ) );
     }
 
-    VertexData.SetNumZeroed( ValidWedgeCount * AttribInfo.tupleSize );
-
     return ValidWedgeCount;
 }
 
 
 
+FHoudiniScopedCookArena::FHoudiniScopedCookArena()
+    : Mark( FMemStack::Get() )
+    , StartByteCount( FMemStack::Get().GetByteCount() )
+{
+    INC_DWORD_STAT( STAT_CookArenaScopes );
+}
+
+FHoudiniScopedCookArena::~FHoudiniScopedCookArena()
+{
+    SET_MEMORY_STAT( STAT_CookArenaLastScopeMemory, FMemStack::Get().GetByteCount() - StartByteCount );
+}
+
+char *
+FHoudiniScopedCookArena::AllocateString( const FString & String )
+{
+    // Without an enclosing scope the string would never be released.
+    check( FMemStack::Get().GetNumMarks() > 0 );
+
+    FTCHARToUTF8 ConvertedString( *String );
+    const int32 StringLength = ConvertedString.Length();
+
+    char * ArenaString = (char *) FMemStack::Get().PushBytes( StringLength + 1, 1 );
+    FMemory::Memcpy( ArenaString, ConvertedString.Get(), StringLength );
+    ArenaString[ StringLength ] = '\0';
+
+    INC_DWORD_STAT( STAT_CookArenaStringAllocations );
+    return ArenaString;
+}
+
 char *
 FHoudiniEngineUtils::ExtractRawName( const FString & Name )
 {
@@ -5938,8 +6772,12 @@ void
 FHoudiniEngineUtils::CreateFaceMaterialArray(
     const TArray< UMaterialInterface * >& Materials, const TArray< int32 > & FaceMaterialIndices, TArray< char * > & OutStaticMeshFaceMaterials )
 {
+    // The names are returned to the caller, so they are released by the caller's arena scope and not by a mark
+    // of our own, which would free them on return.
+    check( FMemStack::Get().GetNumMarks() > 0 );
+
     // We need to create list of unique materials.
-    TArray< char * > UniqueMaterialList;
+    TArray< char *, FHoudiniCookArenaAllocator > UniqueMaterialList;
     UMaterialInterface * MaterialInterface;
     char * UniqueName = nullptr;
 
@@ -5958,7 +6796,7 @@ FHoudiniEngineUtils::CreateFaceMaterialArray(
             }
 
             FString FullMaterialName = MaterialInterface->GetPathName();
-            UniqueName = FHoudiniEngineUtils::ExtractRawName( FullMaterialName );
+            UniqueName = FHoudiniScopedCookArena::AllocateString( FullMaterialName );
             UniqueMaterialList.Add( UniqueName );
         }
     }
@@ -5967,7 +6805,7 @@ FHoudiniEngineUtils::CreateFaceMaterialArray(
         // We do not have any materials, add default.
         MaterialInterface = FHoudiniEngine::Get().GetHoudiniDefaultMaterial().Get();
         FString FullMaterialName = MaterialInterface->GetPathName();
-        UniqueName = FHoudiniEngineUtils::ExtractRawName( FullMaterialName );
+        UniqueName = FHoudiniScopedCookArena::AllocateString( FullMaterialName );
         UniqueMaterialList.Add( UniqueName );
     }
 
@@ -5983,13 +6821,7 @@ FHoudiniEngineUtils::CreateFaceMaterialArray(
 void
 FHoudiniEngineUtils::DeleteFaceMaterialArray( TArray< char * > & OutStaticMeshFaceMaterials )
 {
-    TSet< char * > UniqueMaterials( OutStaticMeshFaceMaterials );
-    for ( TSet< char * >::TIterator Iter = UniqueMaterials.CreateIterator(); Iter; ++Iter )
-    {
-        char* MaterialName = *Iter;
-        FMemory::Free( MaterialName );
-    }
-
+    // The names themselves are released with the cook arena.
     OutStaticMeshFaceMaterials.Empty();
 }
 
@@ -6101,28 +6933,37 @@ FHoudiniEngineUtils::ConvertScaleAndFlipVectorData( const TArray< float > & Data
         ImportAxis = HoudiniRuntimeSettings->ImportAxis;
     }
 
-    for ( int32 Idx = 0; Idx < DataRaw.Num(); Idx += 3 )
-    {
-        FVector Point( DataRaw[ Idx + 0 ], DataRaw[ Idx + 1 ], DataRaw[ Idx + 2 ] );
+    // Not valid enum value.
+    check( ImportAxis == HRSAI_Unreal || ImportAxis == HRSAI_Houdini );
 
-        Point *= GeneratedGeometryScaleFactor;
+    const int32 VectorCount = DataRaw.Num() / 3;
+    const int32 FirstIdx = DataOut.AddUninitialized( VectorCount );
 
-        if ( ImportAxis == HRSAI_Unreal )
-        {
-            Swap(Point.Z, Point.Y);
-        }
-        else if ( ImportAxis == HRSAI_Houdini )
-        {
-            // No action required.
-        }
-        else
-        {
-            // Not valid enum value.
-            check( 0 );
-        }
+    FHoudiniMeshConversionUtils::ConvertVectors(
+        DataRaw.GetData(), VectorCount, GeneratedGeometryScaleFactor,
+        ImportAxis == HRSAI_Unreal, DataOut.GetData() + FirstIdx );
+}
+
+void
+FHoudiniEngineUtils::ConvertScaleAndFlipVectorData( TArray< FVector > & Data )
+{
+    const UHoudiniRuntimeSettings * HoudiniRuntimeSettings = GetDefault< UHoudiniRuntimeSettings >();
+
+    float GeneratedGeometryScaleFactor = HAPI_UNREAL_SCALE_FACTOR_POSITION;
+    EHoudiniRuntimeSettingsAxisImport ImportAxis = HRSAI_Unreal;
 
-        DataOut.Add( Point );
+    if ( HoudiniRuntimeSettings )
+    {
+        GeneratedGeometryScaleFactor = HoudiniRuntimeSettings->GeneratedGeometryScaleFactor;
+        ImportAxis = HoudiniRuntimeSettings->ImportAxis;
     }
+
+    // Not valid enum value.
+    check( ImportAxis == HRSAI_Unreal || ImportAxis == HRSAI_Houdini );
+
+    FHoudiniMeshConversionUtils::ConvertVectors(
+        (const float *) Data.GetData(), Data.Num(), GeneratedGeometryScaleFactor,
+        ImportAxis == HRSAI_Unreal, Data.GetData() );
 }
 
 FString
@@ -6385,51 +7226,103 @@ FHoudiniEngineUtils::LoadLibHAPI( FString & StoredLibHAPILocation )
     return HAPILibraryHandle;
 }
 
-int32
-FHoudiniEngineUtils::HapiGetVertexListForGroup(
-    HAPI_NodeId AssetId, HAPI_NodeId ObjectId, HAPI_NodeId GeoId,
-    HAPI_PartId PartId, const FString & GroupName,
-    const TArray< int32 > & FullVertexList, TArray< int32 > & NewVertexList,
-    TArray< int32 > & AllVertexList, TArray< int32 > & AllFaceList,
-    TArray< int32 > & AllCollisionFaceIndices, const bool& isPackedPrim )
+void
+FHoudiniEngineUtils::HapiPartitionSplitGroups(
+    HAPI_NodeId GeoId, const HAPI_PartInfo & PartInfo, const TArray< int32 > & FullVertexList,
+    const TArray< FString > & SplitGroupNames, TArray< TArray< int32 > > & SplitGroupVertexLists,
+    TArray< TArray< int32 > > & SplitGroupFaceLists, TArray< int32 > & RemainingVertexList,
+    TArray< int32 > & RemainingFaceList )
 {
-    NewVertexList.Init( -1, FullVertexList.Num() );
-    int32 ProcessedWedges = 0;
+    SplitGroupVertexLists.Empty( SplitGroupNames.Num() );
+    SplitGroupVertexLists.SetNum( SplitGroupNames.Num() );
+    SplitGroupFaceLists.Empty( SplitGroupNames.Num() );
+    SplitGroupFaceLists.SetNum( SplitGroupNames.Num() );
+    RemainingVertexList.Empty();
+    RemainingFaceList.Empty();
+
+    const int32 FaceCount = FMath::Min( PartInfo.faceCount, FullVertexList.Num() / 3 );
+    if ( FaceCount <= 0 )
+        return;
 
-    AllFaceList.Empty();
+    FMemMark ArenaMark( FMemStack::Get() );
 
-    TArray< int32 > PartGroupMembership;
-    FHoudiniEngineUtils::HapiGetGroupMembership(
-        AssetId, ObjectId, GeoId, PartId, HAPI_GROUPTYPE_PRIM, GroupName, PartGroupMembership );
+    // Membership buffer shared by all the groups, and number of split groups using each face.
+    TArray< int32, FHoudiniCookArenaAllocator > GroupMembership;
+    GroupMembership.SetNumUninitialized( FaceCount );
+    TArray< int32, FHoudiniCookArenaAllocator > FaceUsage;
+    FaceUsage.SetNumZeroed( FaceCount );
 
-    // Go through all primitives.
-    for ( int32 FaceIdx = 0; FaceIdx < PartGroupMembership.Num(); ++FaceIdx )
+    for ( int32 SplitIdx = 0; SplitIdx < SplitGroupNames.Num(); ++SplitIdx )
     {
-        if ( PartGroupMembership[ FaceIdx ] > 0 )
+        std::string ConvertedGroupName = TCHAR_TO_UTF8( *SplitGroupNames[ SplitIdx ] );
+        HAPI_Result Result = HAPI_RESULT_SUCCESS;
+        if ( !PartInfo.isInstanced )
         {
-            // Add face.
-            AllFaceList.Add( FaceIdx );
+            HOUDINI_CHECK_ERROR( &Result, FHoudiniApi::GetGroupMembership(
+                FHoudiniEngine::Get().GetSession(), GeoId, PartInfo.id, HAPI_GROUPTYPE_PRIM,
+                ConvertedGroupName.c_str(), NULL, &GroupMembership[ 0 ], 0, FaceCount ) );
+        }
+        else
+        {
+            HOUDINI_CHECK_ERROR( &Result, FHoudiniApi::GetGroupMembershipOnPackedInstancePart(
+                FHoudiniEngine::Get().GetSession(), GeoId, PartInfo.id, HAPI_GROUPTYPE_PRIM,
+                ConvertedGroupName.c_str(), NULL, &GroupMembership[ 0 ], 0, FaceCount ) );
+        }
 
-            // This face is a member of specified group.
-            NewVertexList[ FaceIdx * 3 + 0 ] = FullVertexList[ FaceIdx * 3 + 0 ];
-            NewVertexList[ FaceIdx * 3 + 1 ] = FullVertexList[ FaceIdx * 3 + 1 ];
-            NewVertexList[ FaceIdx * 3 + 2 ] = FullVertexList[ FaceIdx * 3 + 2 ];
+        // Groups we fail to fetch are left empty, the caller treats them as invalid.
+        if ( Result != HAPI_RESULT_SUCCESS )
+            continue;
+
+        // Count the members first so the face list is allocated only once.
+        int32 MemberCount = 0;
+        for ( int32 FaceIdx = 0; FaceIdx < FaceCount; ++FaceIdx )
+            MemberCount += GroupMembership[ FaceIdx ] > 0 ? 1 : 0;
+
+        if ( MemberCount <= 0 )
+            continue;
 
-            // Mark these vertex indices as used.
-            AllVertexList[ FaceIdx * 3 + 0 ] = 1;
-            AllVertexList[ FaceIdx * 3 + 1 ] = 1;
-            AllVertexList[ FaceIdx * 3 + 2 ] = 1;
+        TArray< int32 > & FaceList = SplitGroupFaceLists[ SplitIdx ];
+        TArray< int32 > & VertexList = SplitGroupVertexLists[ SplitIdx ];
+        FaceList.SetNumUninitialized( MemberCount );
+        VertexList.Init( -1, FullVertexList.Num() );
 
-            // Mark this face as used.
-            AllCollisionFaceIndices[ FaceIdx ] = 1;
+        int32 MemberIdx = 0;
+        for ( int32 FaceIdx = 0; FaceIdx < FaceCount; ++FaceIdx )
+        {
+            if ( GroupMembership[ FaceIdx ] <= 0 )
+                continue;
 
-            ProcessedWedges += 3;
+            FaceList[ MemberIdx++ ] = FaceIdx;
+            VertexList[ FaceIdx * 3 + 0 ] = FullVertexList[ FaceIdx * 3 + 0 ];
+            VertexList[ FaceIdx * 3 + 1 ] = FullVertexList[ FaceIdx * 3 + 1 ];
+            VertexList[ FaceIdx * 3 + 2 ] = FullVertexList[ FaceIdx * 3 + 2 ];
+            FaceUsage[ FaceIdx ]++;
         }
     }
 
-    return ProcessedWedges;
-}
+    // Faces that do not belong to any split group make up the remaining geometry.
+    int32 RemainingCount = 0;
+    for ( int32 FaceIdx = 0; FaceIdx < FaceCount; ++FaceIdx )
+        RemainingCount += FaceUsage[ FaceIdx ] == 0 ? 1 : 0;
 
+    if ( RemainingCount <= 0 )
+        return;
+
+    RemainingFaceList.SetNumUninitialized( RemainingCount );
+    RemainingVertexList.Init( -1, FullVertexList.Num() );
+
+    int32 RemainingIdx = 0;
+    for ( int32 FaceIdx = 0; FaceIdx < FaceCount; ++FaceIdx )
+    {
+        if ( FaceUsage[ FaceIdx ] != 0 )
+            continue;
+
+        RemainingFaceList[ RemainingIdx++ ] = FaceIdx;
+        RemainingVertexList[ FaceIdx * 3 + 0 ] = FullVertexList[ FaceIdx * 3 + 0 ];
+        RemainingVertexList[ FaceIdx * 3 + 1 ] = FullVertexList[ FaceIdx * 3 + 1 ];
+        RemainingVertexList[ FaceIdx * 3 + 2 ] = FullVertexList[ FaceIdx * 3 + 2 ];
+    }
+}
 
 #if WITH_EDITOR
 
@@ -6647,6 +7540,77 @@ FHoudiniEngineUtils::LocateClipboardActor( const AActor* IgnoreActor, const FStr
     return HoudiniAssetActor;
 }
 
+bool
+FHoudiniEngineUtils::LoadAssetLibrary( UHoudiniAsset * HoudiniAsset, HAPI_AssetLibraryId & OutAssetLibraryId )
+{
+    OutAssetLibraryId = -1;
+
+    if ( !FHoudiniEngineUtils::IsInitialized() || !HoudiniAsset )
+        return false;
+
+    // Library may have already been loaded in this session.
+    if ( FHoudiniEngine::Get().GetCachedAssetLibraryId( HoudiniAsset, OutAssetLibraryId ) )
+        return true;
+
+    FString AssetFileName = HoudiniAsset->GetAssetFileName();
+    HAPI_Result Result = HAPI_RESULT_FAILURE;
+    HAPI_AssetLibraryId AssetLibraryId = -1;
+
+    if ( FPaths::IsRelative( AssetFileName ) && ( FHoudiniEngine::Get().GetSession()->type != HAPI_SESSION_INPROCESS ) )
+        AssetFileName = FPaths::ConvertRelativePathToFull( AssetFileName );
+
+    if ( !AssetFileName.IsEmpty() && FPaths::FileExists( AssetFileName ) )
+    {
+        // We'll need to modify the file name for expanded .hda
+        FString FileExtension = FPaths::GetExtension( AssetFileName );
+        if ( FileExtension.Compare( TEXT( "hdalibrary" ), ESearchCase::IgnoreCase ) == 0 )
+        {
+            // the .hda directory is what we're interested in loading
+            AssetFileName = FPaths::GetPath( AssetFileName );
+        }
+
+        // File does exist, we can load asset from file.
+        std::string AssetFileNamePlain;
+        FHoudiniEngineUtils::ConvertUnrealString( AssetFileName, AssetFileNamePlain );
+
+        Result = FHoudiniApi::LoadAssetLibraryFromFile(
+            FHoudiniEngine::Get().GetSession(), AssetFileNamePlain.c_str(), true, &AssetLibraryId );
+    }
+
+    // Try to load the asset from memory if loading from file failed
+    if ( Result != HAPI_RESULT_SUCCESS )
+    {
+        // Expanded hdas cannot be loaded from  Memory
+        FString FileExtension = FPaths::GetExtension( AssetFileName );
+        if ( FileExtension.Compare( TEXT( "hdalibrary" ), ESearchCase::IgnoreCase ) == 0 )
+        {
+            HOUDINI_LOG_ERROR( TEXT( "Error loading expanded Asset %s: source asset file not found." ), *AssetFileName );
+            return false;
+        }
+        else
+        {
+            // Warn the user that we are loading from memory
+            HOUDINI_LOG_WARNING( TEXT( "Asset %s, loading from Memory: source asset file not found."), *AssetFileName );
+
+            // Otherwise we will try to load from buffer we've cached.
+            Result = FHoudiniApi::LoadAssetLibraryFromMemory(
+                FHoudiniEngine::Get().GetSession(),
+                reinterpret_cast<const char *>( HoudiniAsset->GetAssetBytes() ),
+                HoudiniAsset->GetAssetBytesCount(), true, &AssetLibraryId );
+        }
+    }
+
+    if ( Result != HAPI_RESULT_SUCCESS )
+    {
+        HOUDINI_LOG_MESSAGE( TEXT( "Error loading asset library for %s: %s" ), *AssetFileName, *FHoudiniEngineUtils::GetErrorDescription() );
+        return false;
+    }
+
+    FHoudiniEngine::Get().CacheAssetLibraryId( HoudiniAsset, AssetLibraryId );
+    OutAssetLibraryId = AssetLibraryId;
+    return true;
+}
+
 bool
 FHoudiniEngineUtils::GetAssetNames(
     UHoudiniAsset * HoudiniAsset, HAPI_AssetLibraryId & OutAssetLibraryId,
@@ -6663,55 +7627,12 @@ FHoudiniEngineUtils::GetAssetNames(
         int32 AssetCount = 0;
         TArray< HAPI_StringHandle > AssetNames;
 
-        if ( FPaths::IsRelative( AssetFileName ) && ( FHoudiniEngine::Get().GetSession()->type != HAPI_SESSION_INPROCESS ) )
-            AssetFileName = FPaths::ConvertRelativePathToFull( AssetFileName );
-
-        if ( !AssetFileName.IsEmpty() && FPaths::FileExists( AssetFileName ) )
-        {
-            // We'll need to modify the file name for expanded .hda
-            FString FileExtension = FPaths::GetExtension( AssetFileName );
-            if ( FileExtension.Compare( TEXT( "hdalibrary" ), ESearchCase::IgnoreCase ) == 0 )
-            {
-                // the .hda directory is what we're interested in loading
-                AssetFileName = FPaths::GetPath( AssetFileName );
-            }
-
-            // File does exist, we can load asset from file.
-            std::string AssetFileNamePlain;
-            FHoudiniEngineUtils::ConvertUnrealString( AssetFileName, AssetFileNamePlain );
-
-            Result = FHoudiniApi::LoadAssetLibraryFromFile(
-                FHoudiniEngine::Get().GetSession(), AssetFileNamePlain.c_str(), true, &AssetLibraryId );
-        }
-
-        // Try to load the asset from memory if loading from file failed
-        if ( Result != HAPI_RESULT_SUCCESS )
-        {
-            // Expanded hdas cannot be loaded from  Memory
-            FString FileExtension = FPaths::GetExtension( AssetFileName );
-            if ( FileExtension.Compare( TEXT( "hdalibrary" ), ESearchCase::IgnoreCase ) == 0 )
-            {
-                HOUDINI_LOG_ERROR( TEXT( "Error loading expanded Asset %s: source asset file not found." ), *AssetFileName );
-                return false;
-            }
-            else
-            {
-                // Warn the user that we are loading from memory
-                HOUDINI_LOG_WARNING( TEXT( "Asset %s, loading from Memory: source asset file not found."), *AssetFileName );
-
-                // Otherwise we will try to load from buffer we've cached.
-                Result = FHoudiniApi::LoadAssetLibraryFromMemory(
-                    FHoudiniEngine::Get().GetSession(),
-                    reinterpret_cast<const char *>( HoudiniAsset->GetAssetBytes() ),
-                    HoudiniAsset->GetAssetBytesCount(), true, &AssetLibraryId );
-            }
-        }
+        // Library may have already been loaded and listed in this session.
+        if ( FHoudiniEngine::Get().GetCachedAssetNames( HoudiniAsset, OutAssetLibraryId, OutAssetNames ) )
+            return true;
 
-        if ( Result != HAPI_RESULT_SUCCESS )
-        {
-            HOUDINI_LOG_MESSAGE( TEXT( "Error loading asset library for %s: %s" ), *AssetFileName, *FHoudiniEngineUtils::GetErrorDescription() );
+        if ( !FHoudiniEngineUtils::LoadAssetLibrary( HoudiniAsset, AssetLibraryId ) )
             return false;
-        }
 
         Result = FHoudiniApi::GetAvailableAssetCount( FHoudiniEngine::Get().GetSession(), AssetLibraryId, &AssetCount );
         if ( Result != HAPI_RESULT_SUCCESS )
@@ -6741,6 +7662,8 @@ FHoudiniEngineUtils::GetAssetNames(
             return false;
         }
 
+        FHoudiniEngine::Get().CacheAssetNames( HoudiniAsset, AssetNames );
+
         OutAssetLibraryId = AssetLibraryId;
         OutAssetNames = AssetNames;
     
@@ -7129,7 +8052,8 @@ FHoudiniEngineUtils::AddMeshSocketToList(
             && !GroupName.StartsWith ( TEXT ( HAPI_UNREAL_GROUP_MESH_SOCKETS_OLD ) , ESearchCase::IgnoreCase ) )
             continue;
 
-        TArray< int32 > PointGroupMembership;
+        FMemMark ArenaMark( FMemStack::Get() );
+        TArray< int32, FHoudiniCookArenaAllocator > PointGroupMembership;
         FHoudiniEngineUtils::HapiGetGroupMembership(
             AssetId, ObjectId, GeoId, PartId, 
             HAPI_GROUPTYPE_POINT, GroupName, PointGroupMembership );
@@ -7371,7 +8295,8 @@ FHoudiniEngineUtils::GetGenericAttributeList(
 
             // Since the meshes have been split, we need to find a primitive that belongs to the proper group
             // so we can read the proper value for its generic attribute
-            TArray< int32 > PartGroupMembership;
+            FMemMark ArenaMark( FMemStack::Get() );
+            TArray< int32, FHoudiniCookArenaAllocator > PartGroupMembership;
             FHoudiniEngineUtils::HapiGetGroupMembership(
                 GeoPartObject.AssetId, GeoPartObject.GetObjectId(), GeoPartObject.GetGeoId(), GeoPartObject.GetPartId(), 
                 HAPI_GROUPTYPE_PRIM, GeoPartObject.SplitName, PartGroupMembership );
@@ -8632,22 +9557,11 @@ FHoudiniEngineUtils::GetAllUVAttributesInfoAndTexCoords(
 
 bool
 FHoudiniEngineUtils::AddConvexCollisionToAggregate(
-    const TArray<float>& Positions, const TArray<int32>& SplitGroupVertexList,
+    const TArray<FVector>& Positions, const TArray<int32>& SplitGroupVertexList,
     const bool& MultiHullDecomp, FKAggregateGeom& AggregateCollisionGeo )
 {
 #if WITH_EDITOR
-    // Get runtime settings.
-    const UHoudiniRuntimeSettings * HoudiniRuntimeSettings = GetDefault< UHoudiniRuntimeSettings >();
-    check( HoudiniRuntimeSettings );
-
-    float GeneratedGeometryScaleFactor = HAPI_UNREAL_SCALE_FACTOR_POSITION;
-    EHoudiniRuntimeSettingsAxisImport ImportAxis = HRSAI_Unreal;
-
-    if ( HoudiniRuntimeSettings )
-    {
-        GeneratedGeometryScaleFactor = HoudiniRuntimeSettings->GeneratedGeometryScaleFactor;
-        ImportAxis = HoudiniRuntimeSettings->ImportAxis;
-    }
+    // The positions have already been scaled and converted to the import axis.
 
     // We're only interested in the unique vertices
     TArray<int32> UniqueVertexIndexes;
@@ -8664,21 +9578,7 @@ FHoudiniEngineUtils::AddConvexCollisionToAggregate(
     TArray< FVector > VertexArray;
     VertexArray.SetNum( UniqueVertexIndexes.Num() );
     for ( int32 Idx = 0; Idx < UniqueVertexIndexes.Num(); Idx++ )
-    {
-        int32 VertexIndex = UniqueVertexIndexes[ Idx ];
-
-        VertexArray[ Idx ].X = Positions[ VertexIndex * 3 + 0 ] * GeneratedGeometryScaleFactor;
-        if ( ImportAxis == HRSAI_Unreal )
-        {
-            VertexArray[ Idx ].Y = Positions[ VertexIndex * 3 + 2 ] * GeneratedGeometryScaleFactor;
-            VertexArray[ Idx ].Z = Positions[ VertexIndex * 3 + 1 ] * GeneratedGeometryScaleFactor;
-        }
-        else
-        {
-            VertexArray[ Idx ].Y = Positions[ VertexIndex * 3 + 1 ] * GeneratedGeometryScaleFactor;
-            VertexArray[ Idx ].Z = Positions[ VertexIndex * 3 + 2 ] * GeneratedGeometryScaleFactor;
-        }
-    }
+        VertexArray[ Idx ] = Positions[ UniqueVertexIndexes[ Idx ] ];
 
     if ( MultiHullDecomp && ( VertexArray.Num() >= 3 || UniqueVertexIndexes.Num() >= 3 ) )
     {
@@ -8698,26 +9598,9 @@ FHoudiniEngineUtils::AddConvexCollisionToAggregate(
             Indices.Add( Index );
         }
 
-        // But we need all the positions as vertex
-        TArray< FVector > Vertices;
-        Vertices.SetNum(Positions.Num() / 3);
-        for ( int32 Idx = 0; Idx < Vertices.Num(); Idx++ )
-        {
-            Vertices[ Idx ].X = Positions[ Idx * 3 + 0 ] * GeneratedGeometryScaleFactor;
-            if ( ImportAxis == HRSAI_Unreal )
-            {
-                Vertices[ Idx ].Y = Positions[ Idx * 3 + 2 ] * GeneratedGeometryScaleFactor;
-                Vertices[ Idx ].Z = Positions[ Idx * 3 + 1 ] * GeneratedGeometryScaleFactor;
-            }
-            else
-            {
-                Vertices[ Idx ].Y = Positions[ Idx * 3 + 1 ] * GeneratedGeometryScaleFactor;
-                Vertices[ Idx ].Z = Positions[ Idx * 3 + 2 ] * GeneratedGeometryScaleFactor;
-            }
-        }
-
+        // But we need all the positions as vertex.
         // Run actual util to do the work (if we have some valid input)
-        DecomposeMeshToHulls( bs, Vertices, Indices, 0.5f, 16.0f );
+        DecomposeMeshToHulls( bs, Positions, Indices, 0.5f, 16.0f );
 
         // If we succeed, return here
         // If not, keep going and we'll try to do a single hull decomposition
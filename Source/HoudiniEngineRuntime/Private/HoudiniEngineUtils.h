@@ -29,6 +29,7 @@
 #include "Engine/StaticMesh.h"
 #include "PhysicsEngine/AggregateGeom.h"
 #include "Engine/StaticMeshSocket.h"
+#include "Misc/MemStack.h"
 
 class UStaticMesh;
 class UHoudiniAsset;
@@ -40,6 +41,28 @@ struct FRawMesh;
 
 DECLARE_STATS_GROUP( TEXT( "HoudiniEngine" ), STATGROUP_HoudiniEngine, STATCAT_Advanced );
 
+/** Allocator for transient marshalling buffers, served by the cook arena of the calling thread. **/
+typedef TMemStackAllocator<> FHoudiniCookArenaAllocator;
+
+/** Scope of the linear arena used by the transient buffers of a cook or an input upload, all released when it ends. **/
+struct HOUDINIENGINERUNTIME_API FHoudiniScopedCookArena
+{
+    FHoudiniScopedCookArena();
+    ~FHoudiniScopedCookArena();
+
+    /** Copy a string to the arena of the calling thread, it stays valid until the enclosing scope ends. **/
+    /** Must be called within a cook arena scope. **/
+    static char * AllocateString( const FString & String );
+
+    private:
+
+        /** Arena position when this scope started. **/
+        FMemMark Mark;
+
+        /** Arena size when this scope started, used for the stats. **/
+        int32 StartByteCount;
+};
+
 struct HOUDINIENGINERUNTIME_API UGenericAttribute
 {
     FString AttributeName;
@@ -190,6 +213,51 @@ struct HOUDINIENGINERUNTIME_API UGenericAttribute
     }
 };
 
+#if WITH_EDITOR
+
+/** Per part cache of the attributes of a mesh part, fetched once and shared by all of its split groups. **/
+struct HOUDINIENGINERUNTIME_API FHoudiniPartMeshAttributes
+{
+    FHoudiniPartMeshAttributes();
+
+    /** Return the unique shop name of a material assigned to this part, only querying HAPI the first time. **/
+    bool GetUniqueMaterialShopName( HAPI_NodeId AssetId, HAPI_NodeId MaterialId, FString & Name );
+
+    /** Vertex positions, fetched straight into this array and converted in place to the import axis and scale. **/
+    TArray< FVector > Positions;
+    HAPI_AttributeInfo AttribInfoPositions;
+
+    /** Vertex normals, left empty when normals are always recomputed. **/
+    TArray< float > Normals;
+    HAPI_AttributeInfo AttribInfoNormals;
+
+    /** Vertex colors. **/
+    TArray< float > Colors;
+    HAPI_AttributeInfo AttribInfoColors;
+
+    /** Vertex alpha values. **/
+    TArray< float > Alphas;
+    HAPI_AttributeInfo AttribInfoAlpha;
+
+    /** UV sets. **/
+    TArray< TArray< float > > UVs;
+    TArray< HAPI_AttributeInfo > AttribInfoUVs;
+
+    /** Face smoothing masks. **/
+    TArray< int32 > FaceSmoothingMasks;
+    HAPI_AttributeInfo AttribInfoFaceSmoothingMasks;
+
+    /** Material overrides per face, fetched by the first split group that needs them. **/
+    TArray< FString > FaceMaterialAttributeOverrides;
+    HAPI_AttributeInfo AttribInfoFaceMaterials;
+    bool bFaceMaterialAttributeOverridesFetched;
+
+    /** Unique shop names of the materials assigned to this part. **/
+    TMap< HAPI_NodeId, FString > MaterialShopNames;
+};
+
+#endif // WITH_EDITOR
+
 struct HOUDINIENGINERUNTIME_API FHoudiniEngineUtils
 {
     public:
@@ -271,6 +339,9 @@ struct HOUDINIENGINERUNTIME_API FHoudiniEngineUtils
         /** scaling.                                                                                                    **/
         static void ConvertScaleAndFlipVectorData( const TArray< float > & DataRaw, TArray< FVector > & DataOut );
 
+        /** Scale and flip in place vector data that was fetched straight into an array of vectors. **/
+        static void ConvertScaleAndFlipVectorData( TArray< FVector > & Data );
+
         /** Returns platform specific name of libHAPI. **/
         static FString HoudiniGetLibHAPIName();
 
@@ -283,6 +354,9 @@ struct HOUDINIENGINERUNTIME_API FHoudiniEngineUtils
         /** Helper function to extract copied Houdini actor from clipboard. **/
         static AHoudiniAssetActor * LocateClipboardActor( const AActor* IgnoreActor, const FString & ClipboardText );
 
+        /** Loads the asset library of the HDA in the current session, reusing an already loaded library. **/
+        static bool LoadAssetLibrary( UHoudiniAsset * HoudiniAsset, HAPI_AssetLibraryId & AssetLibraryId );
+
         /** Retrieves list of asset names contained within the HDA. **/
         static bool GetAssetNames(
             UHoudiniAsset * HoudiniAsset, HAPI_AssetLibraryId & AssetLibraryId,
@@ -303,6 +377,9 @@ struct HOUDINIENGINERUNTIME_API FHoudiniEngineUtils
         /** HAPI: Retrieve Path to the given Node, relative to the given Node */
         static bool HapiGetNodePath( HAPI_NodeId NodeId, HAPI_NodeId RelativeToNodeId, FString & OutPath );
 
+        /** HAPI : Retrieve the absolute path of the given node. **/
+        static bool HapiGetAbsoluteNodePath( HAPI_NodeId NodeId, FString & OutPath );
+
         /** HAPI : Retrieve HAPI_ObjectInfo's from given asset node id. **/
         static bool HapiGetObjectInfos( HAPI_NodeId AssetId, TArray< HAPI_ObjectInfo > & ObjectInfos );
 
@@ -327,6 +404,40 @@ struct HOUDINIENGINERUNTIME_API FHoudiniEngineUtils
             const bool& ExportAllLODs = false,
             const bool& ExportSockets = false );
 
+        /** HAPI : Create an input merging the upload of given mesh shared by the session, uploading it if needed. **/
+        static bool HapiCreateInputNodeForSharedStaticMesh(
+            UStaticMesh * Mesh,
+            HAPI_NodeId & ConnectedAssetId,
+            TArray< HAPI_NodeId >& OutCreatedNodeIds,
+            const bool& ExportAllLODs,
+            const bool& ExportSockets );
+
+        /** HAPI : Destroy the shared mesh uploads of the bound session that are no longer merged by any input. **/
+        static void HapiReleaseUnusedSharedStaticMeshInputs();
+
+        /** HAPI : Marshaling, extract geometry and upload it to a new or given input asset - return true on success **/
+        static bool HapiCreateInputNodeForStaticMeshData(
+            UStaticMesh * Mesh,
+            HAPI_NodeId & ConnectedAssetId,
+            TArray< HAPI_NodeId >& OutCreatedNodeIds,
+            class UStaticMeshComponent* StaticMeshComponent,
+            const bool& ExportAllLODs,
+            const bool& ExportSockets );
+
+        /** Return true if the upload of given mesh does not depend on the component and can be shared. **/
+        static bool CanShareStaticMeshInput(
+            UStaticMesh * Mesh, class UStaticMeshComponent* StaticMeshComponent, const bool& ExportAllLODs );
+
+        /** Compute a 64 bit hash of the mesh data and settings used when uploading given mesh. **/
+        static uint64 ComputeStaticMeshInputHash( UStaticMesh * Mesh, const bool& ExportAllLODs, const bool& ExportSockets );
+
+        /** HAPI : Convert and send data in chunks of HAPI_UNREAL_INPUT_UPLOAD_CHUNK_SIZE elements through two halves of **/
+        /** the scratch memory, the next chunk is converted on a worker thread while the current one is sent - return true on success **/
+        static bool HapiUploadInChunks(
+            int32 ElementCount, int32 ElementSize, TArray< uint8 > & ScratchMemory,
+            TFunctionRef< void( int32 ChunkStart, int32 ChunkCount, void * OutChunk ) > ConvertChunk,
+            TFunctionRef< bool( const void * Chunk, int32 ChunkStart, int32 ChunkCount ) > UploadChunk );
+
         /** HAPI : Marshaling, extract geometry and create input asset for it - return true on success **/
         static bool HapiCreateInputNodeForObjects(
             HAPI_NodeId HostAssetId,
@@ -345,7 +456,17 @@ struct HOUDINIENGINERUNTIME_API FHoudiniEngineUtils
             TArray< HAPI_NodeId >& OutCreatedNodeIds,
             const float& SplineResolution = -1.0f,
             const bool& ExportAllLODs = false,
-            const bool& ExportSockets = false );
+            const bool& ExportSockets = false,
+            const bool& ExportAsInstances = false );
+
+        /** HAPI : Marshaling, upload the unique meshes of the outliner inputs once and a point cloud of their instances. **/
+        /** Meshes with per component data are skipped, HapiCreateInputNodeForWorldOutliner uploads them on their own.    **/
+        static bool HapiCreateInputNodeForOutlinerInstances(
+            const TArray< FHoudiniAssetInputOutlinerMesh > & OutlinerMeshArray,
+            HAPI_NodeId & InstancesNodeId,
+            TArray< HAPI_NodeId >& OutCreatedNodeIds,
+            const bool& ExportAllLODs,
+            const bool& ExportSockets );
 
         /** HAPI : Marshaling, extract points from the Unreal Spline and create an input curve for it - return true on success **/
         static bool HapiCreateInputNodeForSpline(
@@ -374,10 +495,11 @@ struct HOUDINIENGINERUNTIME_API FHoudiniEngineUtils
             HAPI_NodeId AssetId, HAPI_NodeId ObjectId, HAPI_NodeId GeoId, HAPI_PartId PartId,
             HAPI_GroupType GroupType, TArray< FString > & GroupNames, const bool& isPackedPrim);
 
-        /** HAPI : Retrieve group membership. **/
+        /** HAPI : Retrieve group membership, in a regular or a cook arena array. **/
+        template< typename AllocatorType >
         static bool HapiGetGroupMembership(
             HAPI_NodeId AssetId, HAPI_NodeId ObjectId, HAPI_NodeId GeoId, HAPI_PartId PartId,
-            HAPI_GroupType GroupType, const FString & GroupName, TArray< int32 > & GroupMembership );
+            HAPI_GroupType GroupType, const FString & GroupName, TArray< int32, AllocatorType > & GroupMembership );
 
         /** HAPI : Get group count by type. **/
         static int32 HapiGetGroupCountByType( HAPI_GroupType GroupType, HAPI_GeoInfo & GeoInfo );
@@ -422,6 +544,12 @@ struct HOUDINIENGINERUNTIME_API FHoudiniEngineUtils
             const FHoudiniGeoPartObject & HoudiniGeoPartObject, const char * Name,
             HAPI_AttributeInfo & ResultAttributeInfo, TArray< float > & Data, int32 TupleSize = 0, HAPI_AttributeOwner Owner = HAPI_ATTROWNER_INVALID );
 
+        /** HAPI : Get a 3 float tuple attribute data directly into an array of vectors, without an intermediate float buffer. **/
+        static bool HapiGetAttributeDataAsFloat(
+            HAPI_NodeId AssetId, HAPI_NodeId ObjectId, HAPI_NodeId GeoId,
+            HAPI_PartId PartId, const char * Name, HAPI_AttributeInfo & ResultAttributeInfo, TArray< FVector > & Data,
+            HAPI_AttributeOwner Owner = HAPI_ATTROWNER_INVALID );
+
         /** HAPI : Get attribute data as integer. **/
         static bool HapiGetAttributeDataAsInteger(
             HAPI_NodeId AssetId, HAPI_NodeId ObjectId, HAPI_NodeId GeoId,
@@ -487,13 +615,13 @@ struct HOUDINIENGINERUNTIME_API FHoudiniEngineUtils
             const FHoudiniGeoPartObject & HoudiniGeoPartObject,
             TArray< FTransform > & Transforms );
 
-        /** HAPI : Given vertex list, retrieve new vertex list for a specified group.                                   **/
-        /** Return number of processed valid index vertices for this split.                                             **/
-        static int32 HapiGetVertexListForGroup(
-            HAPI_NodeId AssetId, HAPI_NodeId ObjectId, HAPI_NodeId GeoId,
-            HAPI_PartId PartId, const FString & GroupName, const TArray< int32 > & FullVertexList,
-            TArray< int32 > & NewVertexList, TArray< int32 > & AllVertexList, TArray< int32 > & AllFaceList,
-            TArray< int32 > & AllCollisionFaceIndices, const bool& isPackedPrim );
+        /** HAPI : Partition the faces of a part between the given split groups, fetching each membership once.        **/
+        /** Groups without faces get empty lists, faces outside of all groups go to the remaining lists.                **/
+        static void HapiPartitionSplitGroups(
+            HAPI_NodeId GeoId, const HAPI_PartInfo & PartInfo, const TArray< int32 > & FullVertexList,
+            const TArray< FString > & SplitGroupNames, TArray< TArray< int32 > > & SplitGroupVertexLists,
+            TArray< TArray< int32 > > & SplitGroupFaceLists, TArray< int32 > & RemainingVertexList,
+            TArray< int32 > & RemainingFaceList );
 
         /** HAPI : Retrieves the mesh sockets list for the current part							**/
         static int32 AddMeshSocketToList(
@@ -525,7 +653,7 @@ struct HOUDINIENGINERUNTIME_API FHoudiniEngineUtils
 
         /** Add convex hull to the mesh's aggregate collision geometry							**/
         static bool AddConvexCollisionToAggregate(
-            const TArray<float>& Positions, const TArray<int32>& SplitGroupVertexList,
+            const TArray<FVector>& Positions, const TArray<int32>& SplitGroupVertexList,
             const bool& MultiHullDecomp, FKAggregateGeom& AggregateCollisionGeo );
 
         /** Add convex hull to the mesh's aggregate collision geometry							**/
@@ -598,6 +726,11 @@ struct HOUDINIENGINERUNTIME_API FHoudiniEngineUtils
             const TArray< int32 > & VertexList, const HAPI_AttributeInfo & AttribInfo, 
             const TArray< float > & Data, TArray< float >& VertexData );
 
+        /** Helper function to transfer attributes to at most MaxWedgeCount wedges of caller owned storage. Returns number of wedges. **/
+        static int32 TransferRegularPointAttributesToVertices(
+            const TArray< int32 > & VertexList, const HAPI_AttributeInfo & AttribInfo,
+            const TArray< float > & Data, float * VertexData, int32 MaxWedgeCount );
+
 #if WITH_EDITOR
 
         /** Helper routine to check if Raw Mesh contains degenerate triangles. **/
@@ -606,7 +739,29 @@ struct HOUDINIENGINERUNTIME_API FHoudiniEngineUtils
         /** Helper routine to count number of degenerate triangles. **/
         static int32 CountDegenerateTriangles( const FRawMesh & RawMesh );
 
-        /** Create helper array of material names, we use it for marshalling. **/
+        /** Build the geometry of a split group raw mesh from its part attributes, safe to call from worker threads. **/
+        /** Returns false if the mesh only contains degenerate triangles. **/
+        static bool BuildRawMeshForSplitGroup(
+            const FHoudiniPartMeshAttributes & PartAttributes, const TArray< int32 > & SplitGroupVertexList,
+            int32 SplitGroupVertexListCount, int32 SplitGroupFaceCount, FRawMesh & RawMesh, int32 & LightMapUVChannel );
+
+        /** Compute a 64 bit hash of the content of a mesh part and of the mesh build settings, used to skip **/
+        /** rebuilding unchanged parts. MeshPropertyHash is the hash of the part's mesh property attributes. **/
+        static uint64 ComputePartGeometryHash(
+            const FHoudiniPartMeshAttributes & PartAttributes, const TArray< int32 > & PartVertexList,
+            const TArray< HAPI_NodeId > & PartFaceMaterialIds, const TArray< int32 > & PartLightMapResolutions,
+            const TArray< FString > & SplitGroupNames, const TMap< FString, TArray< int32 > > & GroupSplitFaces,
+            uint64 MeshPropertyHash );
+
+        /** HAPI : Hash the values of the material override, LOD screen size and uproperty attributes of a part, **/
+        /** which are applied to the generated static meshes. Returns false if they could not be retrieved. **/
+        static bool HapiComputePartMeshPropertyHash( HAPI_NodeId GeoId, const HAPI_PartInfo & PartInfo, uint64 & Hash );
+
+        /** Build the given static meshes as one batch, with a single progress notification. **/
+        static void BuildStaticMeshes( const TArray< UStaticMesh * > & StaticMeshes );
+
+        /** Create helper array of material names, we use it for marshalling. The names live in the cook arena, **/
+        /** so this must be called within a FHoudiniScopedCookArena, they are released when it ends.          **/
         static void CreateFaceMaterialArray(
             const TArray< UMaterialInterface * >& Materials,
             const TArray< int32 > & FaceMaterialIndices,
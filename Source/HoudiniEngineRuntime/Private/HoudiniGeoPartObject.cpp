@@ -86,6 +86,7 @@ FHoudiniGeoPartObject::FHoudiniGeoPartObject()
     , GeoId( -1 )
     , PartId( -1 )
     , SplitId( 0 )
+    , GeometryHash( 0 )
     , bIsVisible( true )
     , bIsInstancer( false )
     , bIsCurve( false )
@@ -123,6 +124,7 @@ FHoudiniGeoPartObject::FHoudiniGeoPartObject(
     , GeoId( InGeoId )
     , PartId( InPartId )
     , SplitId( 0 )
+    , GeometryHash( 0 )
     , bIsVisible( true )
     , bIsInstancer( false )
     , bIsCurve( false )
@@ -161,6 +163,7 @@ FHoudiniGeoPartObject::FHoudiniGeoPartObject(
     , GeoId( GeoInfo.nodeId )
     , PartId( PartInfo.id )
     , SplitId( 0 )
+    , GeometryHash( 0 )
     , bIsVisible( ObjectInfo.isVisible )
     , bIsInstancer( ObjectInfo.isInstancer )
     , bIsCurve( PartInfo.type == HAPI_PARTTYPE_CURVE )
@@ -201,6 +204,7 @@ FHoudiniGeoPartObject::FHoudiniGeoPartObject(
     , GeoId( InGeoId )
     , PartId( InPartId )
     , SplitId( 0 )
+    , GeometryHash( 0 )
     , bIsVisible( true )
     , bIsInstancer( false )
     , bIsCurve( false )
@@ -237,6 +241,7 @@ FHoudiniGeoPartObject::FHoudiniGeoPartObject( const FHoudiniGeoPartObject & GeoP
     , GeoId( GeoPartObject.GeoId )
     , PartId( GeoPartObject.PartId )
     , SplitId( GeoPartObject.SplitId )
+    , GeometryHash( GeoPartObject.GeometryHash )
     , bIsVisible( GeoPartObject.bIsVisible )
     , bIsInstancer( GeoPartObject.bIsInstancer )
     , bIsCurve( GeoPartObject.bIsCurve )
@@ -441,6 +446,9 @@ FHoudiniGeoPartObject::Serialize( FArchive & Ar )
     Ar << PartId;
     Ar << SplitId;
 
+    if ( HoudiniGeoPartObjectVersion >= VER_HOUDINI_PLUGIN_SERIALIZATION_VERSION_GEOMETRY_HASH )
+        Ar << GeometryHash;
+
     Ar << HoudiniGeoPartObjectFlagsPacked;
 
     if ( HoudiniGeoPartObjectVersion < VER_HOUDINI_PLUGIN_SERIALIZATION_VERSION_BASE )
@@ -87,6 +87,8 @@ UHoudiniHandleComponent::Construct(
     const HAPI_HandleInfo & HandleInfo,
     const TMap< HAPI_ParmId, UHoudiniAssetParameter * > & Parameters, EHoudiniHandleType InHandleType )
 {
+    FHoudiniEngineScopedSession ScopedSession( GetSessionIndex() );
+
     HandleType = InHandleType;
     TArray< HAPI_HandleBindingInfo > BindingInfos;
     BindingInfos.SetNumZeroed( HandleInfo.bindingsCount );
@@ -160,6 +162,9 @@ UHoudiniHandleComponent::ResolveDuplicatedParameters( const TMap< HAPI_ParmId, U
 void
 UHoudiniHandleComponent::UpdateTransformParameters()
 {
+    // Called by the handle visualizer, outside of the session scope of the asset.
+    FHoudiniEngineScopedSession ScopedSession( GetSessionIndex() );
+
     HAPI_Transform HapiXform;
     FMemory::Memzero< HAPI_Transform >( HapiXform );
     FHoudiniEngineUtils::TranslateUnrealTransform( GetRelativeTransform(), HapiXform );
@@ -198,6 +203,16 @@ UHoudiniHandleComponent::UpdateTransformParameters()
     XformParms[ EXformParameter::SZ ] = HapiEulerXform.scale[ 2 ];
 }
 
+int32
+UHoudiniHandleComponent::GetSessionIndex() const
+{
+    const UHoudiniAssetComponent * HoudiniAssetComponent = Cast< UHoudiniAssetComponent >( GetAttachParent() );
+    if ( HoudiniAssetComponent )
+        return HoudiniAssetComponent->GetSessionIndex();
+
+    return FHoudiniEngine::GetBoundSessionIndex();
+}
+
 void
 UHoudiniHandleComponent::AddReferencedObjects( UObject * InThis, FReferenceCollector & Collector )
 {
@@ -88,6 +88,9 @@ class HOUDINIENGINERUNTIME_API UHoudiniHandleComponent : public USceneComponent
         static void AddReferencedObjects( UObject * InThis, FReferenceCollector & Collector );
 
     private:
+        // Index of the session the asset this handle is attached to lives in
+        int32 GetSessionIndex() const;
+
         static HAPI_RSTOrder GetHapiRSTOrder( const TSharedPtr< FString > & );
         static HAPI_XYZOrder GetHapiXYZOrder( const TSharedPtr< FString > & );
 
@@ -197,6 +197,7 @@ void UHoudiniInstancedActorComponent::UpdateInstancerComponentInstances(
     if( ISMC )
     {
         ISMC->ClearInstances();
+        ISMC->PerInstanceSMData.Reserve( InstancedTransforms.Num() );
         for( const auto& Transform : ProcessOffsets() )
         {
             ISMC->AddInstance( Transform );
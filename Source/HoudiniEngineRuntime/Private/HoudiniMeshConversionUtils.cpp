@@ -0,0 +1,252 @@
+/*
+* Copyright (c) <2017> Side Effects Software Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*/
+
+#include "HoudiniApi.h"
+#include "HoudiniMeshConversionUtils.h"
+#include "HoudiniEngineRuntimePrivatePCH.h"
+
+#include "Async/ParallelFor.h"
+
+/** Number of elements converted by each task of the export kernels, whole triangles only. **/
+static const int32 HoudiniExportChunkSize = 3 * 16384;
+
+/** Run a conversion over consecutive chunks of a buffer in parallel, passing the start and size of each chunk. **/
+template< typename ChunkFunctionType >
+static void
+ParallelForExportChunks( int32 ElementCount, const ChunkFunctionType & ChunkFunction )
+{
+    const int32 ChunkCount = FMath::DivideAndRoundUp( ElementCount, HoudiniExportChunkSize );
+    ParallelFor( ChunkCount, [&]( int32 ChunkIdx )
+    {
+        const int32 ChunkStart = ChunkIdx * HoudiniExportChunkSize;
+        ChunkFunction( ChunkStart, FMath::Min( HoudiniExportChunkSize, ElementCount - ChunkStart ) );
+    } );
+}
+
+void
+FHoudiniMeshConversionUtils::ConvertVectors(
+    const float * RawData, int32 VectorCount, float ScaleFactor, bool bSwapYZ, FVector * OutVectors )
+{
+    float * OutData = (float *) OutVectors;
+    const VectorRegister Scale = VectorSetFloat1( ScaleFactor );
+
+    // Four vectors (twelve floats, three registers) are converted per iteration:
+    // A = x0 y0 z0 x1, B = y1 z1 x2 y2, C = z2 x3 y3 z3.
+    int32 VectorIdx = 0;
+    for ( ; VectorIdx + 4 <= VectorCount; VectorIdx += 4 )
+    {
+        const float * Src = RawData + VectorIdx * 3;
+        float * Dst = OutData + VectorIdx * 3;
+
+        VectorRegister A = VectorLoad( Src + 0 );
+        VectorRegister B = VectorLoad( Src + 4 );
+        VectorRegister C = VectorLoad( Src + 8 );
+
+        if ( bSwapYZ )
+        {
+            // x0 z0 y0 x1
+            VectorRegister OutA = VectorSwizzle( A, 0, 2, 1, 3 );
+            // z1 y1 x2 z2
+            VectorRegister OutB = VectorShuffle( B, VectorShuffle( B, C, 2, 2, 0, 0 ), 1, 0, 0, 2 );
+            // y2 x3 z3 y3
+            VectorRegister OutC = VectorShuffle( VectorShuffle( B, C, 3, 3, 1, 1 ), C, 0, 2, 3, 2 );
+
+            A = OutA;
+            B = OutB;
+            C = OutC;
+        }
+
+        VectorStore( VectorMultiply( A, Scale ), Dst + 0 );
+        VectorStore( VectorMultiply( B, Scale ), Dst + 4 );
+        VectorStore( VectorMultiply( C, Scale ), Dst + 8 );
+    }
+
+    // Remaining vectors.
+    ConvertVectorsScalar( RawData + VectorIdx * 3, VectorCount - VectorIdx, ScaleFactor, bSwapYZ, OutVectors + VectorIdx );
+}
+
+void
+FHoudiniMeshConversionUtils::ConvertUVs( const float * RawData, int32 UVCount, FVector2D * OutUVs )
+{
+    float * OutData = (float *) OutUVs;
+
+    // ( u, v ) -> ( u, 1 - v ), two texture coordinates per register.
+    const VectorRegister Multiplier = MakeVectorRegister( 1.0f, -1.0f, 1.0f, -1.0f );
+    const VectorRegister Offset = MakeVectorRegister( 0.0f, 1.0f, 0.0f, 1.0f );
+
+    int32 UVIdx = 0;
+    for ( ; UVIdx + 4 <= UVCount; UVIdx += 4 )
+    {
+        const float * Src = RawData + UVIdx * 2;
+        float * Dst = OutData + UVIdx * 2;
+
+        VectorStore( VectorMultiplyAdd( VectorLoad( Src + 0 ), Multiplier, Offset ), Dst + 0 );
+        VectorStore( VectorMultiplyAdd( VectorLoad( Src + 4 ), Multiplier, Offset ), Dst + 4 );
+    }
+
+    // Remaining texture coordinates.
+    ConvertUVsScalar( RawData + UVIdx * 2, UVCount - UVIdx, OutUVs + UVIdx );
+}
+
+void
+FHoudiniMeshConversionUtils::ConvertVectorsScalar(
+    const float * RawData, int32 VectorCount, float ScaleFactor, bool bSwapYZ, FVector * OutVectors )
+{
+    for ( int32 VectorIdx = 0; VectorIdx < VectorCount; ++VectorIdx )
+    {
+        // Read the whole tuple first, so the conversion can be done in place.
+        const float X = RawData[ VectorIdx * 3 + 0 ];
+        const float Y = RawData[ VectorIdx * 3 + 1 ];
+        const float Z = RawData[ VectorIdx * 3 + 2 ];
+
+        FVector & Vector = OutVectors[ VectorIdx ];
+        Vector.X = X * ScaleFactor;
+        if ( bSwapYZ )
+        {
+            Vector.Y = Z * ScaleFactor;
+            Vector.Z = Y * ScaleFactor;
+        }
+        else
+        {
+            Vector.Y = Y * ScaleFactor;
+            Vector.Z = Z * ScaleFactor;
+        }
+    }
+}
+
+void
+FHoudiniMeshConversionUtils::ConvertUVsScalar( const float * RawData, int32 UVCount, FVector2D * OutUVs )
+{
+    for ( int32 UVIdx = 0; UVIdx < UVCount; ++UVIdx )
+    {
+        // We need to flip V coordinate when it's coming from HAPI.
+        const float U = RawData[ UVIdx * 2 + 0 ];
+        const float V = RawData[ UVIdx * 2 + 1 ];
+
+        OutUVs[ UVIdx ].X = U;
+        OutUVs[ UVIdx ].Y = 1.0f - V;
+    }
+}
+
+void
+FHoudiniMeshConversionUtils::ExportVectors(
+    const FVector * InVectors, int32 VectorCount, float ScaleFactor, bool bSwapYZ,
+    bool bSwapWinding, FVector * OutVectors )
+{
+    ParallelForExportChunks( VectorCount, [&]( int32 ChunkStart, int32 ChunkCount )
+    {
+        ConvertVectors(
+            (const float *) ( InVectors + ChunkStart ), ChunkCount, ScaleFactor, bSwapYZ, OutVectors + ChunkStart );
+
+        // Chunks hold whole triangles, so the winding can be fixed while the chunk is still in cache.
+        if ( bSwapWinding )
+            SwapTriangleWinding( OutVectors + ChunkStart, ChunkCount );
+    } );
+}
+
+void
+FHoudiniMeshConversionUtils::ExportUVs( const FVector2D * InUVs, int32 UVCount, bool bSwapWinding, FVector * OutUVs )
+{
+    // ( u, v ) -> ( u, 1 - v, 0 ), two texture coordinates per register.
+    const VectorRegister Multiplier = MakeVectorRegister( 1.0f, -1.0f, 1.0f, -1.0f );
+    const VectorRegister Offset = MakeVectorRegister( 0.0f, 1.0f, 0.0f, 1.0f );
+    const VectorRegister Zero = VectorZero();
+
+    ParallelForExportChunks( UVCount, [&]( int32 ChunkStart, int32 ChunkCount )
+    {
+        const float * SrcData = (const float *) ( InUVs + ChunkStart );
+        float * DstData = (float *) ( OutUVs + ChunkStart );
+
+        // Four texture coordinates (two registers) are expanded to twelve floats (three registers) per iteration:
+        // A = u0 v0 0 u1, B = v1 0 u2 v2, C = 0 u3 v3 0.
+        int32 UVIdx = 0;
+        for ( ; UVIdx + 4 <= ChunkCount; UVIdx += 4 )
+        {
+            const float * Src = SrcData + UVIdx * 2;
+            float * Dst = DstData + UVIdx * 3;
+
+            const VectorRegister UV01 = VectorMultiplyAdd( VectorLoad( Src + 0 ), Multiplier, Offset );
+            const VectorRegister UV23 = VectorMultiplyAdd( VectorLoad( Src + 4 ), Multiplier, Offset );
+
+            // 0 0 u1 v1
+            const VectorRegister ZeroUV1 = VectorShuffle( Zero, UV01, 0, 0, 2, 3 );
+            // u3 v3 0 0
+            const VectorRegister UV3Zero = VectorShuffle( UV23, Zero, 2, 3, 0, 0 );
+
+            VectorStore( VectorShuffle( UV01, ZeroUV1, 0, 1, 0, 2 ), Dst + 0 );
+            VectorStore( VectorShuffle( ZeroUV1, UV23, 3, 0, 0, 1 ), Dst + 4 );
+            VectorStore( VectorSwizzle( UV3Zero, 2, 0, 1, 2 ), Dst + 8 );
+        }
+
+        // Remaining texture coordinates.
+        for ( ; UVIdx < ChunkCount; ++UVIdx )
+        {
+            const FVector2D & UV = InUVs[ ChunkStart + UVIdx ];
+            OutUVs[ ChunkStart + UVIdx ] = FVector( UV.X, 1.0f - UV.Y, 0.0f );
+        }
+
+        if ( bSwapWinding )
+            SwapTriangleWinding( OutUVs + ChunkStart, ChunkCount );
+    } );
+}
+
+void
+FHoudiniMeshConversionUtils::ExportColors(
+    const FColor * InColors, int32 ColorCount, bool bSwapWinding, FLinearColor * OutColors )
+{
+    // Same as FColor::ReinterpretAsLinear, multiplying by the reciprocal instead of dividing.
+    const VectorRegister Scale = VectorSetFloat1( 1.0f / 255.0f );
+
+    ParallelForExportChunks( ColorCount, [&]( int32 ChunkStart, int32 ChunkCount )
+    {
+        const FColor * Src = InColors + ChunkStart;
+        FLinearColor * Dst = OutColors + ChunkStart;
+
+        for ( int32 ColorIdx = 0; ColorIdx < ChunkCount; ++ColorIdx )
+        {
+#if PLATFORM_LITTLE_ENDIAN
+            // FColor is stored as b g r a.
+            const VectorRegister BGRA = VectorLoadByte4( &Src[ ColorIdx ] );
+            VectorStore( VectorMultiply( VectorSwizzle( BGRA, 2, 1, 0, 3 ), Scale ), &Dst[ ColorIdx ].R );
+#else
+            Dst[ ColorIdx ] = Src[ ColorIdx ].ReinterpretAsLinear();
+#endif // PLATFORM_LITTLE_ENDIAN
+        }
+
+        if ( bSwapWinding )
+            SwapTriangleWinding( Dst, ChunkCount );
+    } );
+}
+
+void
+FHoudiniMeshConversionUtils::ExportIndices(
+    const uint32 * InIndices, int32 IndexCount, bool bSwapWinding, int32 * OutIndices )
+{
+    ParallelForExportChunks( IndexCount, [&]( int32 ChunkStart, int32 ChunkCount )
+    {
+        FMemory::Memcpy( OutIndices + ChunkStart, InIndices + ChunkStart, ChunkCount * sizeof( int32 ) );
+
+        if ( bSwapWinding )
+            SwapTriangleWinding( OutIndices + ChunkStart, ChunkCount );
+    } );
+}
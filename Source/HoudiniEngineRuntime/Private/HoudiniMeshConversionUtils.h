@@ -0,0 +1,84 @@
+/*
+* Copyright (c) <2017> Side Effects Software Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/** Conversion of mesh buffers between Houdini and Unreal spaces through VectorRegister, the output may alias the input. **/
+struct HOUDINIENGINERUNTIME_API FHoudiniMeshConversionUtils
+{
+    public:
+
+        /** Scale and optionally swap the Y and Z components of interleaved xyz float data into an array of vectors. **/
+        static void ConvertVectors(
+            const float * RawData, int32 VectorCount, float ScaleFactor, bool bSwapYZ, FVector * OutVectors );
+
+        /** Flip the V coordinate of interleaved uv float data into an array of texture coordinates. **/
+        static void ConvertUVs( const float * RawData, int32 UVCount, FVector2D * OutUVs );
+
+        /** Scalar reference of ConvertVectors, used to validate and measure the vectorized kernel. **/
+        static void ConvertVectorsScalar(
+            const float * RawData, int32 VectorCount, float ScaleFactor, bool bSwapYZ, FVector * OutVectors );
+
+        /** Scalar reference of ConvertUVs, used to validate and measure the vectorized kernel. **/
+        static void ConvertUVsScalar( const float * RawData, int32 UVCount, FVector2D * OutUVs );
+
+        /** Scale and optionally swap Y and Z of Unreal vectors for upload, in parallel chunks of whole triangles. **/
+        static void ExportVectors(
+            const FVector * InVectors, int32 VectorCount, float ScaleFactor, bool bSwapYZ,
+            bool bSwapWinding, FVector * OutVectors );
+
+        /** Flip V of Unreal texture coordinates into the uvw tuples uploaded to Houdini, in parallel chunks. **/
+        static void ExportUVs( const FVector2D * InUVs, int32 UVCount, bool bSwapWinding, FVector * OutUVs );
+
+        /** Reinterpret wedge colors as linear colors for upload, in parallel chunks. **/
+        static void ExportColors( const FColor * InColors, int32 ColorCount, bool bSwapWinding, FLinearColor * OutColors );
+
+        /** Copy wedge indices for upload, in parallel chunks. **/
+        static void ExportIndices( const uint32 * InIndices, int32 IndexCount, bool bSwapWinding, int32 * OutIndices );
+
+        /** Swap the last two wedges of every triangle, to reverse the winding order of per wedge data. **/
+        template< typename ElementType >
+        static void SwapTriangleWinding( TArray< ElementType > & WedgeData );
+
+        /** Swap the last two wedges of every triangle of a raw buffer of per wedge data. **/
+        template< typename ElementType >
+        static void SwapTriangleWinding( ElementType * WedgeData, int32 WedgeCount );
+};
+
+template< typename ElementType >
+void
+FHoudiniMeshConversionUtils::SwapTriangleWinding( TArray< ElementType > & WedgeData )
+{
+    SwapTriangleWinding( WedgeData.GetData(), WedgeData.Num() );
+}
+
+template< typename ElementType >
+void
+FHoudiniMeshConversionUtils::SwapTriangleWinding( ElementType * WedgeData, int32 WedgeCount )
+{
+    WedgeCount -= WedgeCount % 3;
+    for ( int32 WedgeIdx = 0; WedgeIdx < WedgeCount; WedgeIdx += 3 )
+        Swap( WedgeData[ WedgeIdx + 1 ], WedgeData[ WedgeIdx + 2 ] );
+}
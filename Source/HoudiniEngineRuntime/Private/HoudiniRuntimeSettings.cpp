@@ -39,6 +39,9 @@ UHoudiniRuntimeSettings::UHoudiniRuntimeSettings( const FObjectInitializer & Obj
     ServerPipeName = HAPI_UNREAL_SESSION_SERVER_PIPENAME;
     bStartAutomaticServer = HAPI_UNREAL_SESSION_SERVER_AUTOSTART;
     AutomaticServerTimeout = HAPI_UNREAL_SESSION_SERVER_TIMEOUT;
+    SessionPoolSize = 1;
+    SessionWatchdogInterval = HAPI_UNREAL_SESSION_WATCHDOG_INTERVAL;
+    bPreloadAssetLibraries = true;
 
 #if PLATFORM_LINUX
     // Since 4.17, Linux has library conflict, so we need to create an out-of-process session by default
@@ -60,6 +63,10 @@ UHoudiniRuntimeSettings::UHoudiniRuntimeSettings( const FObjectInitializer & Obj
 
     TemporaryCookFolder = LOCTEXT("Temp", "/Game/HoudiniEngine/Temp");
 
+    CookStatusPollMinInterval = HAPI_UNREAL_COOK_STATUS_POLL_MIN_INTERVAL;
+    CookStatusPollMaxInterval = HAPI_UNREAL_COOK_STATUS_POLL_MAX_INTERVAL;
+    CookStatusPollBackoffFactor = HAPI_UNREAL_COOK_STATUS_POLL_BACKOFF_FACTOR;
+
     /** Parameter options. **/
     bTreatRampParametersAsMultiparms = false;
 
@@ -251,6 +258,8 @@ UHoudiniRuntimeSettings::PostEditChangeProperty( struct FPropertyChangedEvent &
         GeneratedGeometryScaleFactor = FMath::Clamp( GeneratedGeometryScaleFactor, KINDA_SMALL_NUMBER, 10000.0f );
     else if ( Property->GetName() == TEXT( "SessionType" ) )
         UpdateSessionUi();
+    else if ( Property->GetName() == TEXT( "SessionPoolSize" ) )
+        SessionPoolSize = FMath::Clamp( SessionPoolSize, 1, HAPI_UNREAL_SESSION_POOL_SIZE_MAX );
     else if ( Property->GetName() == TEXT( "bUseCustomHoudiniLocation" ) )
         SetPropertyReadOnly( TEXT( "CustomHoudiniLocation" ), !bUseCustomHoudiniLocation );
     else if ( Property->GetName() == TEXT( "CustomHoudiniLocation" ) )
@@ -429,6 +438,8 @@ UHoudiniRuntimeSettings::UpdateSessionUi()
     SetPropertyReadOnly( TEXT( "ServerPipeName" ), true );
     SetPropertyReadOnly( TEXT( "bStartAutomaticServer" ), true );
     SetPropertyReadOnly( TEXT( "AutomaticServerTimeout" ), true );
+    SetPropertyReadOnly( TEXT( "SessionPoolSize" ), true );
+    SetPropertyReadOnly( TEXT( "SessionWatchdogInterval" ), true );
 
     bool bServerType = false;
 
@@ -457,6 +468,8 @@ UHoudiniRuntimeSettings::UpdateSessionUi()
     {
         SetPropertyReadOnly( TEXT( "bStartAutomaticServer" ), false );
         SetPropertyReadOnly( TEXT( "AutomaticServerTimeout" ), false );
+        SetPropertyReadOnly( TEXT( "SessionPoolSize" ), false );
+        SetPropertyReadOnly( TEXT( "SessionWatchdogInterval" ), false );
     }
 }
 
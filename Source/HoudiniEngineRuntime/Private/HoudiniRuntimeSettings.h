@@ -214,6 +214,20 @@ class HOUDINIENGINERUNTIME_API UHoudiniRuntimeSettings : public UObject
         UPROPERTY( GlobalConfig, EditAnywhere, Category = Session )
         float AutomaticServerTimeout;
 
+        // Number of Houdini Engine sessions used to instantiate and cook assets in parallel (requires restart).
+        // Only used with socket and named pipe sessions, each extra session uses the next port / a suffixed pipe name.
+        UPROPERTY( GlobalConfig, EditAnywhere, Category = Session, Meta = ( ClampMin = "1", ClampMax = "16", UIMin = "1", UIMax = "16" ) )
+        int32 SessionPoolSize;
+
+        // Interval in seconds between checks of session validity, lost sessions are restarted and their assets
+        // reinstantiated automatically. Set to zero to disable (requires restart).
+        UPROPERTY( GlobalConfig, EditAnywhere, Category = Session, Meta = ( ClampMin = "0.0", UIMin = "0.0", UIMax = "60.0" ) )
+        float SessionWatchdogInterval;
+
+        // Load asset libraries of Houdini assets in the background as they are loaded, so first instantiation is faster.
+        UPROPERTY( GlobalConfig, EditAnywhere, Category = Session )
+        uint32 bPreloadAssetLibraries : 1;
+
     /** Instantiation options. **/
     public:
 
@@ -252,6 +266,18 @@ class HOUDINIENGINERUNTIME_API UHoudiniRuntimeSettings : public UObject
         UPROPERTY(GlobalConfig, EditAnywhere, Category = Cooking)
         FText TemporaryCookFolder;
 
+        // Delay in milliseconds before the second cook status poll, first poll only yields.
+        UPROPERTY( GlobalConfig, EditAnywhere, AdvancedDisplay, Category = Cooking, Meta = ( ClampMin = "0.0", UIMin = "0.0", UIMax = "100.0" ) )
+        float CookStatusPollMinInterval;
+
+        // Maximum delay in milliseconds between cook status polls, long cooks are polled at this rate.
+        UPROPERTY( GlobalConfig, EditAnywhere, AdvancedDisplay, Category = Cooking, Meta = ( ClampMin = "0.0", UIMin = "0.0", UIMax = "1000.0" ) )
+        float CookStatusPollMaxInterval;
+
+        // Factor applied to the delay between cook status polls after each poll.
+        UPROPERTY( GlobalConfig, EditAnywhere, AdvancedDisplay, Category = Cooking, Meta = ( ClampMin = "1.0", UIMin = "1.0", UIMax = "4.0" ) )
+        float CookStatusPollBackoffFactor;
+
     /** Parameter options. **/
     public:
 
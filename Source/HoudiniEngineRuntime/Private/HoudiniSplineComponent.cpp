@@ -250,6 +250,12 @@ UHoudiniSplineComponent::UpdatePoint( int32 PointIndex, const FTransform & Point
 void
 UHoudiniSplineComponent::UploadControlPoints()
 {
+    // Curves are edited in the viewport, outside of the session scope of their asset.
+    const UHoudiniAssetComponent * OwnerComponent = IsInputCurve() && HoudiniAssetInput ?
+        HoudiniAssetInput->GetHoudiniAssetComponent() : Cast< UHoudiniAssetComponent >( GetAttachParent() );
+    FHoudiniEngineScopedSession ScopedSession(
+        OwnerComponent ? OwnerComponent->GetSessionIndex() : FHoudiniEngine::GetBoundSessionIndex() );
+
     HAPI_NodeId HostAssetId = -1;
     HAPI_NodeId NodeId = -1;
     if (HoudiniGeoPartObject.IsValid())
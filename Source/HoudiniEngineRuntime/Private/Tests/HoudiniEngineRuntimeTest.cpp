@@ -1,3 +1,4 @@
+#include "HoudiniEngineRuntimePrivatePCH.h"
 #include "HoudiniApi.h"
 #if WITH_EDITOR
 #include "CoreMinimal.h"
@@ -14,6 +15,7 @@
 #include "HoudiniEngine.h"
 #include "HoudiniAsset.h"
 #include "HoudiniEngineUtils.h"
+#include "HoudiniMeshConversionUtils.h"
 #include "HoudiniParamUtils.h"
 #include "HoudiniCookHandler.h"
 #include "HoudiniRuntimeSettings.h"
@@ -32,6 +34,7 @@ IMPLEMENT_SIMPLE_AUTOMATION_TEST( FHoudiniEngineRuntimeUploadStaticMeshTest, "Ho
 IMPLEMENT_SIMPLE_AUTOMATION_TEST( FHoudiniEngineRuntimeActorTest, "Houdini.Runtime.ActorTest", kTestFlags )
 IMPLEMENT_SIMPLE_AUTOMATION_TEST( FHoudiniEngineRuntimeParamTest, "Houdini.Runtime.ParamTest", kTestFlags )
 IMPLEMENT_SIMPLE_AUTOMATION_TEST( FHoudiniEngineRuntimeBatchTest, "Houdini.Runtime.BatchTest", kTestFlags )
+IMPLEMENT_SIMPLE_AUTOMATION_TEST( FHoudiniEngineRuntimeConversionBenchmark, "Houdini.Runtime.ConversionBenchmark", kTestFlags )
 
 static float TestTickDelay = 1.0f;
 
@@ -759,4 +762,127 @@ bool FHoudiniEngineRuntimeMeshMarshalTest::RunTest( const FString& Parameters )
     return true;
 }
 
+bool FHoudiniEngineRuntimeConversionBenchmark::RunTest( const FString& Parameters )
+{
+    // Odd counts so that the scalar tail of the vectorized kernels is exercised as well.
+    const int32 NumPoints = 2 * 1024 * 1024 + 3;
+    const int32 NumUVs = 2 * 1024 * 1024 + 1;
+    const int32 NumIterations = 10;
+
+    FRandomStream Random( 0x484f5544 );
+    TArray<float> RawPoints, RawUVs;
+    RawPoints.SetNumUninitialized( NumPoints * 3 );
+    RawUVs.SetNumUninitialized( NumUVs * 2 );
+    for( float& Value : RawPoints )
+        Value = Random.FRandRange( -1000.0f, 1000.0f );
+    for( float& Value : RawUVs )
+        Value = Random.FRand();
+
+    TArray<FVector> ScalarPoints, VectorPoints;
+    ScalarPoints.SetNumUninitialized( NumPoints );
+    VectorPoints.SetNumUninitialized( NumPoints );
+    TArray<FVector2D> ScalarUVs, VectorUVs;
+    ScalarUVs.SetNumUninitialized( NumUVs );
+    VectorUVs.SetNumUninitialized( NumUVs );
+
+    for( bool bSwapYZ : { true, false } )
+    {
+        double StartTime = FPlatformTime::Seconds();
+        for( int32 Iteration = 0; Iteration < NumIterations; Iteration++ )
+            FHoudiniMeshConversionUtils::ConvertVectorsScalar(
+                RawPoints.GetData(), NumPoints, HAPI_UNREAL_SCALE_FACTOR_POSITION, bSwapYZ, ScalarPoints.GetData() );
+        const double ScalarTime = FPlatformTime::Seconds() - StartTime;
+
+        StartTime = FPlatformTime::Seconds();
+        for( int32 Iteration = 0; Iteration < NumIterations; Iteration++ )
+            FHoudiniMeshConversionUtils::ConvertVectors(
+                RawPoints.GetData(), NumPoints, HAPI_UNREAL_SCALE_FACTOR_POSITION, bSwapYZ, VectorPoints.GetData() );
+        const double VectorTime = FPlatformTime::Seconds() - StartTime;
+
+        UE_LOG( LogHoudiniTests, Log, TEXT( "Convert %d vectors (swap %d): scalar %.3f ms, vectorized %.3f ms" ),
+            NumPoints, bSwapYZ ? 1 : 0, ScalarTime * 1000.0 / NumIterations, VectorTime * 1000.0 / NumIterations );
+
+        for( int32 Index = 0; Index < NumPoints; Index++ )
+        {
+            if( ScalarPoints[ Index ] != VectorPoints[ Index ] )
+            {
+                TestEqual( TEXT( "Vectors match" ), VectorPoints[ Index ], ScalarPoints[ Index ] );
+                break;
+            }
+        }
+    }
+
+    double StartTime = FPlatformTime::Seconds();
+    for( int32 Iteration = 0; Iteration < NumIterations; Iteration++ )
+        FHoudiniMeshConversionUtils::ConvertUVsScalar( RawUVs.GetData(), NumUVs, ScalarUVs.GetData() );
+    const double ScalarTime = FPlatformTime::Seconds() - StartTime;
+
+    StartTime = FPlatformTime::Seconds();
+    for( int32 Iteration = 0; Iteration < NumIterations; Iteration++ )
+        FHoudiniMeshConversionUtils::ConvertUVs( RawUVs.GetData(), NumUVs, VectorUVs.GetData() );
+    const double VectorTime = FPlatformTime::Seconds() - StartTime;
+
+    UE_LOG( LogHoudiniTests, Log, TEXT( "Convert %d uvs: scalar %.3f ms, vectorized %.3f ms" ),
+        NumUVs, ScalarTime * 1000.0 / NumIterations, VectorTime * 1000.0 / NumIterations );
+
+    for( int32 Index = 0; Index < NumUVs; Index++ )
+    {
+        // The fused multiply-add may round differently than the scalar subtraction.
+        if( !ScalarUVs[ Index ].Equals( VectorUVs[ Index ], KINDA_SMALL_NUMBER ) )
+        {
+            TestEqual( TEXT( "UVs match" ), VectorUVs[ Index ], ScalarUVs[ Index ] );
+            break;
+        }
+    }
+
+    // Winding order patch.
+    TArray<int32> Wedges = { 0, 1, 2, 3, 4, 5, 6 };
+    FHoudiniMeshConversionUtils::SwapTriangleWinding( Wedges );
+    TestTrue( TEXT( "Winding swapped" ), Wedges == TArray<int32>( { 0, 2, 1, 3, 5, 4, 6 } ) );
+
+    // Export kernels, against the per wedge conversion they replace.
+    const int32 NumWedges = 3 * 100000;
+    TArray<FVector2D> ExportSrcUVs;
+    TArray<FColor> ExportSrcColors;
+    ExportSrcUVs.SetNumUninitialized( NumWedges );
+    ExportSrcColors.SetNumUninitialized( NumWedges );
+    for( int32 Index = 0; Index < NumWedges; Index++ )
+    {
+        ExportSrcUVs[ Index ] = FVector2D( Random.FRand(), Random.FRand() );
+        ExportSrcColors[ Index ] = FColor( (uint32) Random.GetUnsignedInt() );
+    }
+
+    TArray<FVector> ExportedUVs;
+    TArray<FLinearColor> ExportedColors;
+    ExportedUVs.SetNumUninitialized( NumWedges );
+    ExportedColors.SetNumUninitialized( NumWedges );
+
+    StartTime = FPlatformTime::Seconds();
+    FHoudiniMeshConversionUtils::ExportUVs( ExportSrcUVs.GetData(), NumWedges, true, ExportedUVs.GetData() );
+    FHoudiniMeshConversionUtils::ExportColors( ExportSrcColors.GetData(), NumWedges, true, ExportedColors.GetData() );
+    UE_LOG( LogHoudiniTests, Log, TEXT( "Export %d wedge uvs and colors: %.3f ms" ),
+        NumWedges, ( FPlatformTime::Seconds() - StartTime ) * 1000.0 );
+
+    for( int32 Index = 0; Index < NumWedges; Index++ )
+    {
+        // Wedges 1 and 2 of every triangle are swapped.
+        const int32 SrcIndex = Index % 3 == 0 ? Index : ( Index % 3 == 1 ? Index + 1 : Index - 1 );
+        const FVector ExpectedUV( ExportSrcUVs[ SrcIndex ].X, 1.0f - ExportSrcUVs[ SrcIndex ].Y, 0.0f );
+        if( !ExportedUVs[ Index ].Equals( ExpectedUV, KINDA_SMALL_NUMBER ) )
+        {
+            TestEqual( TEXT( "Exported UVs match" ), ExportedUVs[ Index ], ExpectedUV );
+            break;
+        }
+
+        const FLinearColor ExpectedColor = ExportSrcColors[ SrcIndex ].ReinterpretAsLinear();
+        if( !ExportedColors[ Index ].Equals( ExpectedColor, KINDA_SMALL_NUMBER ) )
+        {
+            TestTrue( TEXT( "Exported colors match" ), false );
+            break;
+        }
+    }
+
+    return true;
+}
+
 #endif // WITH_EDITOR
\ No newline at end of file
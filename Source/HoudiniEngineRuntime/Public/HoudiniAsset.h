@@ -39,6 +39,7 @@ class HOUDINIENGINERUNTIME_API UHoudiniAsset : public UObject
     /** UObject methods. **/
     public:
 
+        virtual void PostLoad() override;
         virtual void FinishDestroy() override;
         virtual void Serialize( FArchive & Ar ) override;
         virtual void GetAssetRegistryTags( TArray< FAssetRegistryTag > & OutTags ) const override;
@@ -57,6 +58,9 @@ class HOUDINIENGINERUNTIME_API UHoudiniAsset : public UObject
         /** Return the size in bytes of raw Houdini OTL data. **/
         uint32 GetAssetBytesCount() const;
 
+        /** Return hash of raw Houdini OTL data, used to detect changed libraries. **/
+        uint32 GetAssetBytesHash() const;
+
         /** Returns true if this asset contains Houdini logo. **/
         bool IsPreviewHoudiniLogo() const;
 
@@ -100,6 +104,9 @@ class HOUDINIENGINERUNTIME_API UHoudiniAsset : public UObject
         /** Field containing the size of raw Houdini OTL data in bytes. **/
         uint32 AssetBytesCount;
 
+        /** Hash of raw Houdini OTL data, computed when data is created or loaded. **/
+        uint32 AssetBytesHash;
+
         /** Version of the asset file format. **/
         uint32 FileFormatVersion;
 
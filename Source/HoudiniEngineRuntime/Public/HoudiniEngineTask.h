@@ -41,7 +41,28 @@ namespace EHoudiniEngineTaskType
         AssetCooking,
 
         /** This type is used for asynchronous asset deletion. **/
-        AssetDeletion
+        AssetDeletion,
+
+        /** This type corresponds to instantiation of several assets at once, see BatchTasks. **/
+        AssetBatchInstantiation,
+
+        /** This type is used for loading asset library ahead of instantiation, no task info is produced. **/
+        AssetLibraryLoading
+    };
+}
+
+namespace EHoudiniEngineTaskPriority
+{
+    enum Type
+    {
+        /** Background work, for example assets which are not visible. **/
+        Low,
+
+        /** Default priority. **/
+        Normal,
+
+        /** Selected or visible assets, their cooks may pre-empt running lower priority cooks. **/
+        High
     };
 }
 
@@ -74,4 +95,16 @@ struct HOUDINIENGINERUNTIME_API FHoudiniEngineTask
 
     /** Is set to true if component has been loaded. **/
     bool bLoadedComponent;
+
+    /** Index of the pooled session this task must be processed on. **/
+    int32 SessionIndex;
+
+    /** Priority of this task, higher priority tasks are processed first. **/
+    EHoudiniEngineTaskPriority::Type Priority;
+
+    /** Number of times this cook has been pre-empted and restarted. **/
+    int32 PreemptionCount;
+
+    /** Instantiation tasks processed together by a batch instantiation task. **/
+    TArray< FHoudiniEngineTask > BatchTasks;
 };
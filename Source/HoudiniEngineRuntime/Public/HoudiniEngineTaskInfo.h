@@ -65,6 +65,9 @@ struct HOUDINIENGINERUNTIME_API FHoudiniEngineTaskInfo
     /** String used for status / progress bar. **/
     FText StatusText;
 
+    /** Progress of the cook between 0 and 1, based on the number of cooked nodes. **/
+    float Progress;
+
     /** Is set to true if corresponding task was issued for loaded component. **/
     bool bLoadedComponent;
 };
@@ -560,6 +560,9 @@ struct HOUDINIENGINERUNTIME_API FHoudiniGeoPartObject
         /** Id of a split. In most cases this will be 0. **/
         int32 SplitId;
 
+        /** Hash of the geometry this part was generated from, 0 if unknown. **/
+        uint64 GeometryHash;
+
         /** Path to the corresponding node */
         mutable FString NodePath;
 